@@ -86,37 +86,94 @@ extern void yyerror(const char *filename, const char *msg);
     boropsym = 273,                /* "BOR"  */
     noropsym = 274,                /* "NOR"  */
     xoropsym = 275,                /* "XOR"  */
-    mulopsym = 276,                /* "MUL"  */
-    divopsym = 277,                /* "DIV"  */
-    sllopsym = 278,                /* "SLL"  */
-    srlopsym = 279,                /* "SRL"  */
-    mfhiopsym = 280,               /* "MFHI"  */
-    mfloopsym = 281,               /* "MFLO"  */
-    jropsym = 282,                 /* "JR"  */
-    addiopsym = 283,               /* "ADDI"  */
-    andiopsym = 284,               /* "ANDI"  */
-    boriopsym = 285,               /* "BORI"  */
-    xoriopsym = 286,               /* "XORI"  */
-    beqopsym = 287,                /* "BEQ"  */
-    bgezopsym = 288,               /* "BGEZ"  */
-    bgtzopsym = 289,               /* "BGTZ"  */
-    blezopsym = 290,               /* "BLEZ"  */
-    bltzopsym = 291,               /* "BLTZ"  */
-    bneopsym = 292,                /* "BNE"  */
-    lbuopsym = 293,                /* "LBU"  */
-    lwopsym = 294,                 /* "LW"  */
-    sbopsym = 295,                 /* "SB"  */
-    swopsym = 296,                 /* "SW"  */
-    jmpopsym = 297,                /* "JMP"  */
-    jalopsym = 298,                /* "JAL"  */
-    exitopsym = 299,               /* "EXIT"  */
-    pstropsym = 300,               /* "PSTR"  */
-    pchopsym = 301,                /* "PCH"  */
-    rchopsym = 302,                /* "RCH"  */
-    straopsym = 303,               /* "STRA"  */
-    notropsym = 304,               /* "NOTR"  */
-    regsym = 305,                  /* regsym  */
-    wordsym = 306                  /* "WORD"  */
+    sltopsym = 276,                /* "SLT"  */
+    sltuopsym = 277,               /* "SLTU"  */
+    movzopsym = 278,               /* "MOVZ"  */
+    movnopsym = 279,               /* "MOVN"  */
+    lwxopsym = 280,                /* "LWX"  */
+    swxopsym = 281,                /* "SWX"  */
+    lbuxopsym = 282,               /* "LBUX"  */
+    sbxopsym = 283,                /* "SBX"  */
+    paddbopsym = 284,              /* "PADDB"  */
+    paddhopsym = 285,              /* "PADDH"  */
+    psubbopsym = 286,              /* "PSUBB"  */
+    psubhopsym = 287,              /* "PSUBH"  */
+    paddusbopsym = 288,            /* "PADDUSB"  */
+    paddushopsym = 289,            /* "PADDUSH"  */
+    pcmpeqbopsym = 290,            /* "PCMPEQB"  */
+    pcmpeqhopsym = 291,            /* "PCMPEQH"  */
+    pselbopsym = 292,              /* "PSELB"  */
+    faddopsym = 293,               /* "FADD"  */
+    fsubopsym = 294,               /* "FSUB"  */
+    fmulopsym = 295,               /* "FMUL"  */
+    fdivopsym = 296,               /* "FDIV"  */
+    feqopsym = 297,                /* "FEQ"  */
+    fltopsym = 298,                /* "FLT"  */
+    fleopsym = 299,                /* "FLE"  */
+    cvtswopsym = 300,              /* "CVTSW"  */
+    cvtwsopsym = 301,              /* "CVTWS"  */
+    mulopsym = 302,                /* "MUL"  */
+    divopsym = 303,                /* "DIV"  */
+    sllopsym = 304,                /* "SLL"  */
+    srlopsym = 305,                /* "SRL"  */
+    sraopsym = 306,                /* "SRA"  */
+    sllvopsym = 307,               /* "SLLV"  */
+    srlvopsym = 308,               /* "SRLV"  */
+    mfhiopsym = 309,               /* "MFHI"  */
+    mfloopsym = 310,               /* "MFLO"  */
+    jropsym = 311,                 /* "JR"  */
+    jalropsym = 312,               /* "JALR"  */
+    addiopsym = 313,               /* "ADDI"  */
+    andiopsym = 314,               /* "ANDI"  */
+    boriopsym = 315,               /* "BORI"  */
+    xoriopsym = 316,               /* "XORI"  */
+    sltiopsym = 317,               /* "SLTI"  */
+    sltiuopsym = 318,              /* "SLTIU"  */
+    luiopsym = 319,                /* "LUI"  */
+    liopsym = 320,                 /* "LI"  */
+    beqopsym = 321,                /* "BEQ"  */
+    bgezopsym = 322,               /* "BGEZ"  */
+    bgtzopsym = 323,               /* "BGTZ"  */
+    blezopsym = 324,               /* "BLEZ"  */
+    bltzopsym = 325,               /* "BLTZ"  */
+    bneopsym = 326,                /* "BNE"  */
+    loopopsym = 327,               /* "LOOP"  */
+    lbuopsym = 328,                /* "LBU"  */
+    lwopsym = 329,                 /* "LW"  */
+    sbopsym = 330,                 /* "SB"  */
+    swopsym = 331,                 /* "SW"  */
+    lbopsym = 332,                 /* "LB"  */
+    lhopsym = 333,                 /* "LH"  */
+    lhuopsym = 334,                /* "LHU"  */
+    shopsym = 335,                 /* "SH"  */
+    lwmopsym = 336,                /* "LWM"  */
+    swmopsym = 337,                /* "SWM"  */
+    jmpopsym = 338,                /* "JMP"  */
+    jalopsym = 339,                /* "JAL"  */
+    exitopsym = 340,               /* "EXIT"  */
+    pstropsym = 341,               /* "PSTR"  */
+    pchopsym = 342,                /* "PCH"  */
+    rchopsym = 343,                /* "RCH"  */
+    straopsym = 344,               /* "STRA"  */
+    notropsym = 345,               /* "NOTR"  */
+    rbufopsym = 346,               /* "RBUF"  */
+    wbufopsym = 347,               /* "WBUF"  */
+    rlnopsym = 348,                /* "RLN"  */
+    fopenopsym = 349,              /* "FOPEN"  */
+    freadopsym = 350,              /* "FREAD"  */
+    fwriteopsym = 351,             /* "FWRITE"  */
+    fcloseopsym = 352,             /* "FCLOSE"  */
+    fmapopsym = 353,               /* "FMAP"  */
+    syscallopsym = 354,            /* "SYSCALL"  */
+    pintopsym = 355,               /* "PINT"  */
+    phexopsym = 356,               /* "PHEX"  */
+    rintopsym = 357,               /* "RINT"  */
+    icntopsym = 358,               /* "ICNT"  */
+    clockopsym = 359,              /* "CLOCK"  */
+    mcpyopsym = 360,               /* "MCPY"  */
+    msetopsym = 361,               /* "MSET"  */
+    regsym = 362,                  /* regsym  */
+    wordsym = 363                  /* "WORD"  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -40,27 +40,68 @@ extern void yyerror(const char *filename, const char *msg);
 %token <token> boropsym   "BOR"
 %token <token> noropsym   "NOR"
 %token <token> xoropsym   "XOR"
+%token <token> sltopsym   "SLT"
+%token <token> sltuopsym  "SLTU"
+%token <token> movzopsym    "MOVZ"
+%token <token> movnopsym    "MOVN"
+%token <token> lwxopsym     "LWX"
+%token <token> swxopsym     "SWX"
+%token <token> lbuxopsym    "LBUX"
+%token <token> sbxopsym     "SBX"
+%token <token> paddbopsym   "PADDB"
+%token <token> paddhopsym   "PADDH"
+%token <token> psubbopsym   "PSUBB"
+%token <token> psubhopsym   "PSUBH"
+%token <token> paddusbopsym "PADDUSB"
+%token <token> paddushopsym "PADDUSH"
+%token <token> pcmpeqbopsym "PCMPEQB"
+%token <token> pcmpeqhopsym "PCMPEQH"
+%token <token> pselbopsym   "PSELB"
+%token <token> faddopsym    "FADD"
+%token <token> fsubopsym    "FSUB"
+%token <token> fmulopsym    "FMUL"
+%token <token> fdivopsym    "FDIV"
+%token <token> feqopsym     "FEQ"
+%token <token> fltopsym     "FLT"
+%token <token> fleopsym     "FLE"
+%token <token> cvtswopsym   "CVTSW"
+%token <token> cvtwsopsym   "CVTWS"
 %token <token> mulopsym   "MUL"
 %token <token> divopsym   "DIV"
 %token <token> sllopsym   "SLL"
 %token <token> srlopsym   "SRL"
+%token <token> sraopsym   "SRA"
+%token <token> sllvopsym  "SLLV"
+%token <token> srlvopsym  "SRLV"
 %token <token> mfhiopsym  "MFHI"
 %token <token> mfloopsym  "MFLO"
 %token <token> jropsym    "JR"
+%token <token> jalropsym  "JALR"
 %token <token> addiopsym  "ADDI"
 %token <token> andiopsym  "ANDI"
 %token <token> boriopsym   "BORI"
 %token <token> xoriopsym  "XORI"
+%token <token> sltiopsym  "SLTI"
+%token <token> sltiuopsym "SLTIU"
+%token <token> luiopsym   "LUI"
+%token <token> liopsym    "LI"
 %token <token> beqopsym   "BEQ"
 %token <token> bgezopsym  "BGEZ"
 %token <token> bgtzopsym  "BGTZ"
 %token <token> blezopsym  "BLEZ"
 %token <token> bltzopsym  "BLTZ"
 %token <token> bneopsym   "BNE"
+%token <token> loopopsym  "LOOP"
 %token <token> lbuopsym   "LBU"
 %token <token> lwopsym    "LW"
 %token <token> sbopsym    "SB"
 %token <token> swopsym    "SW"
+%token <token> lbopsym    "LB"
+%token <token> lhopsym    "LH"
+%token <token> lhuopsym   "LHU"
+%token <token> shopsym    "SH"
+%token <token> lwmopsym   "LWM"
+%token <token> swmopsym   "SWM"
 %token <token> jmpopsym   "JMP"
 %token <token> jalopsym   "JAL"
 %token <token> exitopsym    "EXIT"
@@ -69,6 +110,22 @@ extern void yyerror(const char *filename, const char *msg);
 %token <token> rchopsym     "RCH"
 %token <token> straopsym    "STRA"
 %token <token> notropsym    "NOTR"
+%token <token> rbufopsym    "RBUF"
+%token <token> wbufopsym    "WBUF"
+%token <token> rlnopsym     "RLN"
+%token <token> fopenopsym   "FOPEN"
+%token <token> freadopsym   "FREAD"
+%token <token> fwriteopsym  "FWRITE"
+%token <token> fcloseopsym  "FCLOSE"
+%token <token> fmapopsym    "FMAP"
+%token <token> syscallopsym "SYSCALL"
+%token <token> pintopsym    "PINT"
+%token <token> phexopsym    "PHEX"
+%token <token> rintopsym    "RINT"
+%token <token> icntopsym    "ICNT"
+%token <token> clockopsym   "CLOCK"
+%token <token> mcpyopsym    "MCPY"
+%token <token> msetopsym    "MSET"
 
 %token <reg> regsym
 
@@ -84,14 +141,17 @@ extern void yyerror(const char *filename, const char *msg);
 %type <label_opt> labelOpt
 %type <instr> instr
 %type <asm_instr> asmInstr
+%type <asm_instrs> pseudoInstr
 %type <instr> threeRegInstr
 %type <instr> twoRegInstr
 %type <instr> shiftInstr
 %type <instr> oneRegInstr
 %type <instr> immedArithInstr
 %type <instr> immedBoolInstr
+%type <instr> loadUpperInstr
 %type <instr> branchTestInstr
 %type <instr> loadStoreInstr
+%type <instr> loadStoreMultipleInstr
 %type <instr> jumpInstr
 %type <instr> syscallInstr
 %type <token> threeRegOp
@@ -100,6 +160,7 @@ extern void yyerror(const char *filename, const char *msg);
 %type <unsignednum> shift
 %type <token> moveHiLoOp
 %type <token> jrOp
+%type <token> srcDestOp
 %type <token> immedArithOp
 %type <number> immed
 %type <number> number
@@ -109,6 +170,7 @@ extern void yyerror(const char *filename, const char *msg);
 %type <token> branchTest1Op
 %type <number> offset
 %type <token> loadStoreOp
+%type <token> loadStoreMultipleOp
 %type <token> jumpOp
 %type <token> syscallOp
 %type <data_section> dataSection
@@ -158,13 +220,20 @@ lora : label { $$ = ast_lora_label($1); }
      ;
 
 asmInstrs : asmInstr { $$ = ast_asm_instrs_singleton($1); }
+          | pseudoInstr
           | asmInstrs asmInstr { $$ = ast_asm_instrs_add($1,$2); }
+          | asmInstrs pseudoInstr { $$ = ast_asm_instrs_append($1,$2); }
           ;
 
 label : identsym ;
 
 asmInstr : labelOpt instr eolsym { $$ = ast_asm_instr($1,$2); } ;
 
+// pseudo-instructions expand to a list of instructions
+pseudoInstr : labelOpt "LI" regsym "," number eolsym
+              { $$ = ast_load_immediate($1, $2, $3.number, $5.value); }
+            ;
+
 labelOpt : label ":" { $$ = ast_label_opt_label($1); }
          | empty { $$ = ast_label_opt_empty($1); }
          ;
@@ -172,8 +241,8 @@ labelOpt : label ":" { $$ = ast_label_opt_label($1); }
 empty : %empty { $$ = ast_empty(lexer_filename(), lexer_line()); } ;
 
 instr : threeRegInstr | twoRegInstr | shiftInstr | oneRegInstr
-      | immedArithInstr | immedBoolInstr | branchTestInstr 
-      | loadStoreInstr | jumpInstr | syscallInstr
+      | immedArithInstr | immedBoolInstr | loadUpperInstr | branchTestInstr 
+      | loadStoreInstr | loadStoreMultipleInstr | jumpInstr | syscallInstr
       ;
 
 threeRegInstr : threeRegOp regsym "," regsym "," regsym
@@ -185,7 +254,12 @@ threeRegInstr : threeRegOp regsym "," regsym "," regsym
 		}
               ;
 
-threeRegOp : "ADD" | "SUB" | "AND" | "BOR" | "NOR" | "XOR" ;
+threeRegOp : "ADD" | "SUB" | "AND" | "BOR" | "NOR" | "XOR"
+           | "SLT" | "SLTU" | "SLLV" | "SRLV" | "MOVZ" | "MOVN"
+           | "LWX" | "SWX" | "LBUX" | "SBX"
+           | "PADDB" | "PADDH" | "PSUBB" | "PSUBH" | "PADDUSB" | "PADDUSH"
+           | "PCMPEQB" | "PCMPEQH" | "PSELB"
+           | "FADD" | "FSUB" | "FMUL" | "FDIV" | "FEQ" | "FLT" | "FLE" ;
 
 twoRegInstr : twoRegOp regsym "," regsym
               {
@@ -208,7 +282,7 @@ shiftInstr : shiftOp regsym "," regsym "," shift
 	   }
            ;
 
-shiftOp : "SLL" | "SRL" ;
+shiftOp : "SLL" | "SRL" | "SRA" ;
 
 shift : unsignednumsym ;
 
@@ -226,12 +300,22 @@ oneRegInstr : moveHiLoOp regsym
 				 lexer_token2func($1.code),
 				 ik_none, ast_immed_none());
 	      }
+              | srcDestOp regsym "," regsym
+              {
+		  // say we are using 3 registers,
+		  // because the registers used are rs and rd, not rt
+		  $$ = ast_instr($1, reg_instr_type, 3, $2.number, 0, $4.number,
+				 lexer_token2func($1.code),
+				 ik_none, ast_immed_none());
+	      }
               ;
 
 moveHiLoOp : "MFHI" | "MFLO" ;
 
 jrOp : "JR" ;
 
+srcDestOp : "JALR" | "CVTSW" | "CVTWS" ;
+
 immedArithInstr : immedArithOp regsym "," regsym "," immed
                   {
 		      $$ = ast_instr($1, immed_instr_type, 2, $2.number,
@@ -240,7 +324,7 @@ immedArithInstr : immedArithOp regsym "," regsym "," immed
 		  }
                 ;
 
-immedArithOp : "ADDI" ;
+immedArithOp : "ADDI" | "SLTI" | "SLTIU" ;
 
 immed : number ;
 
@@ -268,6 +352,15 @@ immedBoolInstr : immedBoolOp regsym "," regsym "," unsignednumsym
 
 immedBoolOp : "ANDI" | "BORI" | "XORI" ;
 
+loadUpperInstr : "LUI" regsym "," unsignednumsym
+                 {
+		     // say we are using 2 registers,
+		     // because the register number goes in rt, not rs
+		     $$ = ast_instr($1, immed_instr_type, 2, 0, $2.number, 0, 0,
+				    ik_uimmed, ast_immed_unsigned($4.value));
+		 }
+               ;
+
 branchTestInstr : branchTest2Op regsym "," regsym "," offset
                   {
 		      $$ = ast_instr($1, immed_instr_type, 2, $2.number,
@@ -283,7 +376,7 @@ branchTestInstr : branchTest2Op regsym "," regsym "," offset
 
 branchTest2Op : "BEQ" | "BNE" ;
 
-branchTest1Op : "BGEZ" | "BGTZ" | "BLEZ" | "BLTZ" ;
+branchTest1Op : "BGEZ" | "BGTZ" | "BLEZ" | "BLTZ" | "LOOP" ;
 
 offset : number ;
 
@@ -295,7 +388,19 @@ loadStoreInstr : loadStoreOp regsym "," regsym "," offset
 		 }
                ;
 
-loadStoreOp : "LBU" | "LW" | "SB" | "SW" ;
+loadStoreOp : "LBU" | "LW" | "SB" | "SW" | "LB" | "LH" | "LHU" | "SH" ;
+
+// the registers are the base address and the first of the registers
+// that the mask selects from
+loadStoreMultipleInstr : loadStoreMultipleOp regsym "," regsym "," unsignednumsym
+                         {
+			     $$ = ast_instr($1, immed_instr_type, 2, $2.number,
+					    $4.number, 0, 0,
+					    ik_uimmed, ast_immed_unsigned($6.value));
+			 }
+                       ;
+
+loadStoreMultipleOp : "LWM" | "SWM" ;
 
 
 jumpInstr : jumpOp lora
@@ -316,9 +421,31 @@ syscallInstr : syscallOp
 				SYSCALL_F,
 				ik_syscall_code, id);
 	     }
+             | "SYSCALL" unsignednumsym
+             {
+		 // only plugins' codes; the others have their own mnemonics
+		 if ($2.value < PLUGIN_FIRST_SYSCALL
+		     || $2.value >= PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS) {
+		     char msg[100];
+		     sprintf(msg, "SYSCALL code %u is not a plugin code (%d to %d)",
+			     $2.value, PLUGIN_FIRST_SYSCALL,
+			     PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS - 1);
+		     yyerror(lexer_filename(), msg);
+		     YYERROR;
+		 }
+		 immedData_t id;
+		 id.id_data_kind = id_syscall_code;
+		 id.data.syscall_code = $2.value;
+		 $$ = ast_instr($1, syscall_instr_type, 0, 0, 0, 0,
+				SYSCALL_F,
+				ik_syscall_code, id);
+	     }
              ;
 
-syscallOp : "EXIT" | "PSTR" | "PCH" | "RCH" | "STRA" | "NOTR" ;
+syscallOp : "EXIT" | "PSTR" | "PCH" | "RCH" | "STRA" | "NOTR" | "RBUF"
+          | "WBUF" | "RLN" | "FOPEN" | "FREAD" | "FWRITE" | "FCLOSE"
+          | "FMAP" | "PINT" | "PHEX" | "RINT" | "ICNT" | "CLOCK"
+          | "MCPY" | "MSET" ;
 
 dataSection : ".data" staticStartAddr staticDecls
               { $$ = ast_data_section($1, $2.value, $3); }
@@ -338,6 +465,7 @@ dataSize : "WORD" { $$ = ast_data_size($1, BYTES_PER_WORD); }
          ;
 
 initializerOpt : "=" number { $$ = ast_initializer_given($1, $2.value); }
+               | "=" label { $$ = ast_initializer_label($1, $2); }
                | empty { $$ = ast_initializer_empty($1); }
                ;
 
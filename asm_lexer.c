@@ -383,8 +383,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 84
-#define YY_END_OF_BUFFER 85
+#define YY_NUM_RULES 141
+#define YY_END_OF_BUFFER 142
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -392,27 +392,42 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[173] =
+static const flex_int16_t yy_accept[304] =
     {   0,
-        0,    0,    0,    0,    0,    0,   85,   83,    1,    5,
-        1,    2,   83,   42,   44,   43,   83,   51,   51,   50,
-       49,   82,   82,   82,   82,   82,   82,   82,   82,   82,
-       82,   82,   82,   82,   82,    3,    1,    4,    1,    5,
-        2,   52,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   51,    0,   82,   82,   82,   82,   82,
-       82,   82,   82,   82,   82,   82,   82,   18,   82,   30,
-       82,   82,   82,   82,   82,   82,   31,   82,   82,   82,
-       82,   32,   82,   82,    3,    4,   56,   57,   58,   59,
-       53,   80,   78,   81,   68,   69,   70,   71,   72,   73,
-
-       74,   75,   79,   60,   61,   62,   63,   64,   65,   66,
-       67,   76,   77,   54,   55,    0,    0,    0,    0,   51,
-        6,    8,   23,   82,   82,   82,   82,   28,    9,   13,
-       82,   34,   33,   29,   82,   82,   12,   10,   82,   37,
-       82,   38,   14,   15,   82,    7,   82,   11,    0,   48,
-        0,    0,   19,   20,   24,   26,   25,   27,   21,   35,
-       16,   17,   40,   36,   39,   41,   22,   46,    0,   45,
-       47,    0
+        0,    0,    0,    0,    0,    0,  142,  140,    1,    5,
+        1,    2,  140,   99,  101,  100,  140,  108,  108,  107,
+      106,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,    3,    1,
+        4,    1,    5,    2,  109,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  108,    0,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,   47,   68,   69,   56,  139,  139,   65,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+
+      139,  139,  139,  139,  139,   66,   71,  139,  139,  139,
+      139,   67,  139,  139,  139,  139,    3,    4,  113,  114,
+      115,  116,  110,  137,  135,  138,  125,  126,  127,  128,
+      129,  130,  131,  132,  136,  117,  118,  119,  120,  121,
+      122,  123,  124,  133,  134,  111,  112,    0,    0,    0,
+        0,  108,    6,    8,   57,  139,  139,  139,  139,   62,
+        9,  139,  139,   39,  139,  139,  139,  139,   33,   35,
+       34,  139,  139,  139,  139,  139,  139,  139,   75,   74,
+       64,   70,  139,   55,   72,   16,  139,  139,  139,  139,
+      139,   38,   10,  139,  139,   78,  139,  139,  139,  139,
+
+      139,  139,  139,   79,  139,   84,   19,   40,   12,   42,
+       41,  139,    7,   73,   17,  139,  139,  139,   11,    0,
+      105,    0,    0,   49,   50,   58,   60,   59,   61,   51,
+      139,  139,  139,   76,   29,  139,   32,   89,   31,  139,
+      139,   30,  139,   94,   48,   18,   63,   96,   45,   46,
+       15,   14,   97,   81,  139,  139,   92,   91,  139,   77,
+      139,   82,   93,   43,   53,   13,   44,   80,  139,   83,
+       98,   52,  103,    0,  102,   95,   36,   37,  139,   85,
+       86,  139,   20,   21,  139,  139,   28,   22,   23,   54,
+      139,  104,   88,   87,  139,  139,  139,   24,   25,   26,
+
+       27,   90,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -425,12 +440,12 @@ static const YY_CHAR yy_ec[256] =
        14,   15,   16,   17,   18,   19,   20,   21,    1,    1,
        22,    1,    1,    1,   23,   24,   25,   26,   27,   28,
        29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
-       39,   40,   41,   42,   43,   44,   45,   46,   33,   47,
-        1,    1,    1,    1,   33,    1,   48,   49,   50,   51,
+       39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
+        1,    1,    1,    1,   49,    1,   50,   51,   52,   53,
 
-       52,   53,   54,   33,   33,   33,   55,   33,   33,   56,
-       33,   57,   33,   58,   59,   60,   33,   61,   33,   62,
-       33,   33,    1,    1,    1,    1,    1,    1,    1,    1,
+       54,   55,   56,   49,   49,   49,   57,   49,   49,   58,
+       49,   59,   49,   60,   61,   62,   49,   63,   49,   64,
+       49,   49,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -447,99 +462,144 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[63] =
+static const YY_CHAR yy_meta[65] =
     {   0,
         1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         1,    1,    4,    4,    4,    4,    4,    4,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    4,    4,    4,
-        4,    4,    4,    5,    5,    5,    5,    5,    5,    5,
-        5,    6
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    4,
+        4,    4,    4,    4,    4,    5,    5,    5,    5,    5,
+        5,    5,    5,    6
     } ;
 
-static const flex_int16_t yy_base[178] =
+static const flex_int16_t yy_base[309] =
     {   0,
-        0,    0,   60,   62,   64,   66,  224,  225,  225,  225,
-      220,    0,   60,  225,  225,  225,   30,  160,  159,  225,
-      225,   57,   58,    0,  189,  173,   61,   62,   60,  181,
-       74,  192,   82,  179,  178,  225,  211,  225,  210,  225,
-        0,    0,   98,  155,  154,  162,  117,  164,   86,  161,
-      152,  147,  154,  143,    0,    0,  178,  177,  163,   75,
-       96,  174,  153,  148,  155,  139,  134,    0,  128,    0,
-       70,  136,   97,  139,  126,  137,    0,  132,  131,  124,
-      139,    0,  122,  121,  225,  225,  225,  225,  225,  225,
-      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
-
-      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
-      225,  225,  225,  225,  225,  100,  108,  109,   94,    0,
-      124,  123,    0,  106,  105,  104,  103,    0,  118,    0,
-      106,    0,    0,    0,  116,  109,    0,    0,  105,    0,
-      104,    0,    0,    0,  120,    0,  116,  110,   92,  225,
-       86,   66,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  225,   50,  225,
-      225,  225,  184,  188,  192,   88,  196
+        0,    0,   62,   64,   66,   68,  354,  355,  355,  355,
+      350,    0,   62,  355,  355,  355,   30,  288,  287,  355,
+      355,   59,   60,   54,  319,  303,  103,    0,  323,   67,
+       90,  114,  310,   78,  122,  128,   62,  309,  355,  342,
+      355,  341,  355,    0,    0,  152,  284,  283,  291,  165,
+      214,   93,  290,  281,  276,  283,  272,    0,    0,  309,
+      308,  294,   73,   89,  305,  291,  293,  287,  284,  296,
+      300,  291,  293,  284,  107,   70,  284,  294,  277,  279,
+      282,  283,  278,    0,  272,  271,    0,  276,  281,  115,
+      273,   76,  266,  282,  274,  127,  281,  106,  279,  269,
+
+      145,  261,  273,  266,  265,  254,    0,  150,  151,  259,
+      274,  151,  256,  253,  255,  254,  355,  355,  355,  355,
+      355,  355,  355,  355,  355,  355,  355,  355,  355,  355,
+      355,  355,  355,  355,  355,  355,  355,  355,  355,  355,
+      355,  355,  355,  355,  355,  355,  355,  231,  239,  241,
+      226,    0,  258,  257,    0,  239,  238,  237,  236,    0,
+      252,  257,  148,    0,  239,  254,  242,  234,    0,    0,
+        0,  239,  242,  248,  251,  249,  241,  229,  230,    0,
+      223,    0,  230,    0,    0,    0,  220,  235,  228,  154,
+      222,    0,    0,  223,  236,    0,  223,  214,  217,  224,
+
+      217,  232,  227,    0,  212,    0,    0,  209,  160,    0,
+      208,  228,    0,    0,    0,  218,  214,  210,  192,  172,
+      355,  169,  158,    0,    0,    0,    0,    0,    0,    0,
+      186,  173,  176,    0,    0,  175,    0,    0,    0,  179,
+      186,    0,  169,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  170,  183,    0,    0,  185,    0,
+      130,    0,    0,    0,  165,    0,    0,    0,  184,    0,
+        0,    0,  355,  149,  355,    0,    0,    0,  178,    0,
+        0,  172,    0,    0,  155,  120,    0,    0,    0,    0,
+      111,  355,    0,    0,  171,  174,   98,    0,    0,    0,
+
+        0,    0,  355,  234,  238,  242,  108,  246
     } ;
 
-static const flex_int16_t yy_def[178] =
+static const flex_int16_t yy_def[309] =
     {   0,
-      172,    1,    1,    1,    1,    1,  172,  172,  172,  172,
-      172,  173,  172,  172,  172,  172,  172,  174,  174,  172,
-      172,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  172,  172,  172,  172,  172,
-      173,  176,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  174,  177,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  177,
-      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  175,  175,  175,  172,  172,
-      172,  172,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  175,  175,  175,  175,  175,  175,  172,  172,  172,
-      172,    0,  172,  172,  172,  172,  172
+      303,    1,    1,    1,    1,    1,  303,  303,  303,  303,
+      303,  304,  303,  303,  303,  303,  303,  305,  305,  303,
+      303,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  303,  303,
+      303,  303,  303,  304,  307,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  305,  308,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  308,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  303,
+      303,  303,  303,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  306,  303,  303,  303,  306,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  306,  306,  306,  306,
+      306,  303,  306,  306,  306,  306,  306,  306,  306,  306,
+
+      306,  306,    0,  303,  303,  303,  303,  303
     } ;
 
-static const flex_int16_t yy_nxt[288] =
+static const flex_int16_t yy_nxt[420] =
     {   0,
         8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
        18,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       20,   21,   22,   23,   24,   25,   26,   24,   24,   24,
-       24,   27,   24,   28,   29,   30,   24,   31,   24,   32,
-       33,   24,   24,   24,   34,   35,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   36,   37,   36,   37,   38,   39,   38,   39,
-       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
-       50,   51,   57,   66,   59,   69,   60,   71,   52,   53,
-       42,   61,   58,   62,   63,   67,  114,  115,   74,  135,
-
-       68,  124,   72,  136,  171,   77,   70,   43,   87,   88,
-       89,   90,   44,   45,   75,   78,  125,   46,   47,   48,
-       49,   79,  126,   80,   81,  170,   82,   95,   96,   97,
-       98,   99,  100,  101,  102,  169,  138,  127,  139,  168,
-      167,  166,  165,  164,  163,  162,  161,  160,  159,  158,
-      157,  156,  155,  154,  153,  152,  151,   91,  150,  149,
-      148,  147,  146,  145,  144,  143,  142,  141,  140,  137,
-      134,  133,  132,  103,  104,  105,  106,  107,  108,  109,
-      110,  111,  112,  113,   41,  131,   41,   41,   41,   41,
-       54,  130,  129,   54,   56,   56,   56,   56,  120,  120,
-
-      128,  123,  122,  121,  172,  119,  118,  117,  116,   94,
-       93,   92,   86,   85,   84,   83,   76,   73,   65,   64,
-      172,   55,   40,  172,    7,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172
+       20,   21,   22,   23,   24,   25,   26,   27,   28,   28,
+       29,   30,   28,   31,   32,   33,   28,   34,   28,   35,
+       36,   28,   28,   28,   37,   38,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   39,   40,   39,   40,   41,   42,
+       41,   42,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   53,   54,   60,  114,   62,   67,   63,   82,
+       55,   56,  172,   64,   61,   65,   66,   68,  115,  156,
+
+       97,   83,   98,  146,  147,  188,   84,   99,  100,  189,
+       45,   46,  173,   85,  157,  158,   47,   48,  101,   86,
+       87,   49,   50,   51,   52,   71,   88,   72,   73,   74,
+      159,  302,   89,  170,   90,  196,   75,   76,   91,   77,
+      197,   92,   78,   79,  297,  102,  103,   80,  171,  185,
+       93,  106,  104,  288,   94,  105,   95,  107,  296,  289,
+      186,  108,  119,  120,  121,  122,  193,  109,  194,  110,
+      111,  200,  112,  210,  113,  127,  128,  129,  130,  131,
+      132,  133,  134,  208,  211,  214,  201,  202,  232,  251,
+      265,  209,  233,  283,  298,  295,  215,  300,  294,  284,
+
+      299,  252,  266,  301,  293,  292,  291,  290,  287,  286,
+      282,  281,  285,  123,  280,  279,  278,  277,  276,  275,
+      274,  273,  272,  135,  136,  137,  138,  139,  140,  141,
+      142,  143,  144,  145,   44,  271,   44,   44,   44,   44,
+       57,  270,  269,   57,   59,   59,   59,   59,  152,  152,
+      268,  267,  264,  263,  262,  261,  260,  259,  258,  257,
+      256,  255,  254,  253,  250,  249,  248,  247,  246,  245,
+      244,  243,  242,  241,  240,  239,  238,  237,  236,  235,
+      234,  231,  230,  229,  228,  227,  226,  225,  224,  223,
+      222,  221,  220,  219,  218,  217,  216,  213,  212,  207,
+
+      206,  205,  204,  203,  199,  198,  195,  192,  191,  190,
+      187,  184,  183,  182,  181,  180,  179,  178,  177,  176,
+      175,  174,  169,  168,  167,  166,  165,  164,  163,  162,
+      161,  160,  155,  154,  153,  303,  151,  150,  149,  148,
+      126,  125,  124,  118,  117,  116,   96,   81,   70,   69,
+      303,   58,   43,  303,    7,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303
     } ;
 
-static const flex_int16_t yy_chk[288] =
+static const flex_int16_t yy_chk[420] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -547,41 +607,59 @@ static const flex_int16_t yy_chk[288] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    4,    4,    5,    5,    6,    6,
-       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
-       17,   17,   22,   27,   23,   28,   23,   29,   17,   17,
-      176,   23,   22,   23,   23,   27,   49,   49,   31,   71,
-
-       27,   60,   29,   71,  169,   33,   28,   13,   43,   43,
-       43,   43,   13,   13,   31,   33,   60,   13,   13,   13,
-       13,   33,   61,   33,   33,  152,   33,   47,   47,   47,
-       47,   47,   47,   47,   47,  151,   73,   61,   73,  149,
-      148,  147,  145,  141,  139,  136,  135,  131,  129,  127,
-      126,  125,  124,  122,  121,  119,  118,   43,  117,  116,
-       84,   83,   81,   80,   79,   78,   76,   75,   74,   72,
-       69,   67,   66,   47,   48,   48,   48,   48,   48,   48,
-       48,   48,   48,   48,  173,   65,  173,  173,  173,  173,
-      174,   64,   63,  174,  175,  175,  175,  175,  177,  177,
-
-       62,   59,   58,   57,   54,   53,   52,   51,   50,   46,
-       45,   44,   39,   37,   35,   34,   32,   30,   26,   25,
-       19,   18,   11,    7,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172
+        1,    1,    1,    1,    3,    3,    4,    4,    5,    5,
+        6,    6,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   17,   17,   22,   37,   23,   24,   23,   30,
+       17,   17,   76,   23,   22,   23,   23,   24,   37,   63,
+
+       34,   30,   34,   52,   52,   92,   30,   34,   34,   92,
+      307,   13,   76,   31,   63,   64,   13,   13,   34,   31,
+       31,   13,   13,   13,   13,   27,   31,   27,   27,   27,
+       64,  297,   31,   75,   31,   98,   27,   27,   32,   27,
+       98,   32,   27,   27,  291,   35,   35,   27,   75,   90,
+       32,   36,   35,  261,   32,   35,   32,   36,  286,  261,
+       90,   36,   46,   46,   46,   46,   96,   36,   96,   36,
+       36,  101,   36,  109,   36,   50,   50,   50,   50,   50,
+       50,   50,   50,  108,  109,  112,  101,  101,  163,  190,
+      209,  108,  163,  255,  295,  285,  112,  296,  282,  255,
+
+      295,  190,  209,  296,  279,  274,  269,  265,  259,  256,
+      243,  241,  255,   46,  240,  236,  233,  232,  231,  223,
+      222,  220,  219,   50,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,  304,  218,  304,  304,  304,  304,
+      305,  217,  216,  305,  306,  306,  306,  306,  308,  308,
+      212,  211,  208,  205,  203,  202,  201,  200,  199,  198,
+      197,  195,  194,  191,  189,  188,  187,  183,  181,  179,
+      178,  177,  176,  175,  174,  173,  172,  168,  167,  166,
+      165,  162,  161,  159,  158,  157,  156,  154,  153,  151,
+      150,  149,  148,  116,  115,  114,  113,  111,  110,  106,
+
+      105,  104,  103,  102,  100,   99,   97,   95,   94,   93,
+       91,   89,   88,   86,   85,   83,   82,   81,   80,   79,
+       78,   77,   74,   73,   72,   71,   70,   69,   68,   67,
+       66,   65,   62,   61,   60,   57,   56,   55,   54,   53,
+       49,   48,   47,   42,   40,   38,   33,   29,   26,   25,
+       19,   18,   11,    7,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+
+      303,  303,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  303,  303,  303,  303,  303,  303,  303,  303
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static const flex_int32_t yy_rule_can_match_eol[85] =
+static const flex_int32_t yy_rule_can_match_eol[142] =
     {   0,
 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0,     };
 
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
@@ -677,12 +755,12 @@ static void unsignednum2ast(unsigned int val)
     yylval = t;
 }
 
-#line 680 "asm_lexer.c"
+#line 758 "asm_lexer.c"
 #line 101 "asm_lexer.l"
   /* states of the lexer */
 
 
-#line 685 "asm_lexer.c"
+#line 763 "asm_lexer.c"
 
 #define INITIAL 0
 #define INSTRUCTION 1
@@ -914,7 +992,7 @@ YY_DECL
 #line 106 "asm_lexer.l"
 
 
-#line 917 "asm_lexer.c"
+#line 995 "asm_lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -941,13 +1019,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 173 )
+				if ( yy_current_state >= 304 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 225 );
+		while ( yy_base[yy_current_state] != 355 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1042,201 +1120,486 @@ YY_RULE_SETUP
 case 12:
 YY_RULE_SETUP
 #line 120 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(mulopsym); return mulopsym; }
+{ BEGIN INSTRUCTION; tok2ast(sltopsym); return sltopsym; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
 #line 121 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(divopsym); return divopsym; }
+{ BEGIN INSTRUCTION; tok2ast(sltuopsym); return sltuopsym; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
 #line 122 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(sllopsym); return sllopsym; }
+{ BEGIN INSTRUCTION; tok2ast(movzopsym); return movzopsym; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
 #line 123 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(srlopsym); return srlopsym; }
+{ BEGIN INSTRUCTION; tok2ast(movnopsym); return movnopsym; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
 #line 124 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(mfhiopsym); return mfhiopsym; }
+{ BEGIN INSTRUCTION; tok2ast(lwxopsym); return lwxopsym; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 125 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(mfloopsym); return mfloopsym; }
+{ BEGIN INSTRUCTION; tok2ast(swxopsym); return swxopsym; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 126 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(jropsym); return jropsym; }
+{ BEGIN INSTRUCTION; tok2ast(lbuxopsym); return lbuxopsym; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 127 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(addiopsym); return addiopsym; }
+{ BEGIN INSTRUCTION; tok2ast(sbxopsym); return sbxopsym; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 128 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(andiopsym); return andiopsym; }
+{ BEGIN INSTRUCTION; tok2ast(paddbopsym); return paddbopsym; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 129 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(boriopsym); return boriopsym; }
+{ BEGIN INSTRUCTION; tok2ast(paddhopsym); return paddhopsym; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 130 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(xoriopsym); return xoriopsym; }
+{ BEGIN INSTRUCTION; tok2ast(psubbopsym); return psubbopsym; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 131 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(beqopsym); return beqopsym; }
+{ BEGIN INSTRUCTION; tok2ast(psubhopsym); return psubhopsym; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 132 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(bgezopsym); return bgezopsym; }
+{ BEGIN INSTRUCTION; tok2ast(paddusbopsym); return paddusbopsym; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 133 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(blezopsym); return blezopsym; }
+{ BEGIN INSTRUCTION; tok2ast(paddushopsym); return paddushopsym; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 134 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(bgtzopsym); return bgtzopsym; }
+{ BEGIN INSTRUCTION; tok2ast(pcmpeqbopsym); return pcmpeqbopsym; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 135 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(bltzopsym); return bltzopsym; }
+{ BEGIN INSTRUCTION; tok2ast(pcmpeqhopsym); return pcmpeqhopsym; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 136 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(bneopsym); return bneopsym; }
+{ BEGIN INSTRUCTION; tok2ast(pselbopsym); return pselbopsym; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 137 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(lbuopsym); return lbuopsym; }
+{ BEGIN INSTRUCTION; tok2ast(faddopsym); return faddopsym; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 138 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(lwopsym); return lwopsym; }
+{ BEGIN INSTRUCTION; tok2ast(fsubopsym); return fsubopsym; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 139 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(sbopsym); return sbopsym; }
+{ BEGIN INSTRUCTION; tok2ast(fmulopsym); return fmulopsym; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 140 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(swopsym); return swopsym; }
+{ BEGIN INSTRUCTION; tok2ast(fdivopsym); return fdivopsym; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 141 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(jmpopsym); return jmpopsym; }
+{ BEGIN INSTRUCTION; tok2ast(feqopsym); return feqopsym; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 142 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(jalopsym); return jalopsym; }
+{ BEGIN INSTRUCTION; tok2ast(fltopsym); return fltopsym; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 143 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(exitopsym); return exitopsym; }
+{ BEGIN INSTRUCTION; tok2ast(fleopsym); return fleopsym; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 144 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(pstropsym); return pstropsym; }
+{ BEGIN INSTRUCTION; tok2ast(cvtswopsym); return cvtswopsym; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 145 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(pchopsym); return pchopsym; }
+{ BEGIN INSTRUCTION; tok2ast(cvtwsopsym); return cvtwsopsym; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 146 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(rchopsym); return rchopsym; }
+{ BEGIN INSTRUCTION; tok2ast(mulopsym); return mulopsym; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 147 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(straopsym); return straopsym; }
+{ BEGIN INSTRUCTION; tok2ast(divopsym); return divopsym; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 148 "asm_lexer.l"
-{ BEGIN INSTRUCTION; tok2ast(notropsym); return notropsym; }
+{ BEGIN INSTRUCTION; tok2ast(sllopsym); return sllopsym; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 150 "asm_lexer.l"
-{ BEGIN DATADECL; tok2ast(wordsym); return wordsym; }
+#line 149 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(srlopsym); return srlopsym; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 152 "asm_lexer.l"
-{ tok2ast(plussym); return plussym; }
+#line 150 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(sraopsym); return sraopsym; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 153 "asm_lexer.l"
-{ tok2ast(minussym); return minussym; }
+#line 151 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(sllvopsym); return sllvopsym; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 154 "asm_lexer.l"
-{ return commasym; }
+#line 152 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(srlvopsym); return srlvopsym; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 156 "asm_lexer.l"
-{ tok2ast(dottextsym); return dottextsym; }
+#line 153 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(mfhiopsym); return mfhiopsym; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 157 "asm_lexer.l"
-{ tok2ast(dotdatasym); return dotdatasym; }
+#line 154 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(mfloopsym); return mfloopsym; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 158 "asm_lexer.l"
-{ tok2ast(dotstacksym); return dotstacksym; }
+#line 155 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(jropsym); return jropsym; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 159 "asm_lexer.l"
-{ return dotendsym; }
+#line 156 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(jalropsym); return jalropsym; }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 160 "asm_lexer.l"
-{ tok2ast(equalsym); return equalsym; }
+#line 157 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(addiopsym); return addiopsym; }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 161 "asm_lexer.l"
-{ return colonsym; }
+#line 158 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(andiopsym); return andiopsym; }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
+#line 159 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(boriopsym); return boriopsym; }
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+#line 160 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(xoriopsym); return xoriopsym; }
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+#line 161 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(sltiopsym); return sltiopsym; }
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 162 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(sltiuopsym); return sltiuopsym; }
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
 #line 163 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(luiopsym); return luiopsym; }
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+#line 164 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(liopsym); return liopsym; }
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 165 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(beqopsym); return beqopsym; }
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 166 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(bgezopsym); return bgezopsym; }
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+#line 167 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(blezopsym); return blezopsym; }
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+#line 168 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(bgtzopsym); return bgtzopsym; }
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+#line 169 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(bltzopsym); return bltzopsym; }
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+#line 170 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(bneopsym); return bneopsym; }
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+#line 171 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(loopopsym); return loopopsym; }
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+#line 172 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lbuopsym); return lbuopsym; }
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+#line 173 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lwopsym); return lwopsym; }
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+#line 174 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(sbopsym); return sbopsym; }
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+#line 175 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(swopsym); return swopsym; }
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+#line 176 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lbopsym); return lbopsym; }
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+#line 177 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lhopsym); return lhopsym; }
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+#line 178 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lhuopsym); return lhuopsym; }
+	YY_BREAK
+case 71:
+YY_RULE_SETUP
+#line 179 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(shopsym); return shopsym; }
+	YY_BREAK
+case 72:
+YY_RULE_SETUP
+#line 180 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(lwmopsym); return lwmopsym; }
+	YY_BREAK
+case 73:
+YY_RULE_SETUP
+#line 181 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(swmopsym); return swmopsym; }
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+#line 182 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(jmpopsym); return jmpopsym; }
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+#line 183 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(jalopsym); return jalopsym; }
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+#line 184 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(exitopsym); return exitopsym; }
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+#line 185 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(pstropsym); return pstropsym; }
+	YY_BREAK
+case 78:
+YY_RULE_SETUP
+#line 186 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(pchopsym); return pchopsym; }
+	YY_BREAK
+case 79:
+YY_RULE_SETUP
+#line 187 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(rchopsym); return rchopsym; }
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+#line 188 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(straopsym); return straopsym; }
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+#line 189 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(notropsym); return notropsym; }
+	YY_BREAK
+case 82:
+YY_RULE_SETUP
+#line 190 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(rbufopsym); return rbufopsym; }
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+#line 191 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(wbufopsym); return wbufopsym; }
+	YY_BREAK
+case 84:
+YY_RULE_SETUP
+#line 192 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(rlnopsym); return rlnopsym; }
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+#line 193 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(fopenopsym); return fopenopsym; }
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
+#line 194 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(freadopsym); return freadopsym; }
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 195 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(fwriteopsym); return fwriteopsym; }
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+#line 196 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(fcloseopsym); return fcloseopsym; }
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+#line 197 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(fmapopsym); return fmapopsym; }
+	YY_BREAK
+case 90:
+YY_RULE_SETUP
+#line 198 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(syscallopsym); return syscallopsym; }
+	YY_BREAK
+case 91:
+YY_RULE_SETUP
+#line 199 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(pintopsym); return pintopsym; }
+	YY_BREAK
+case 92:
+YY_RULE_SETUP
+#line 200 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(phexopsym); return phexopsym; }
+	YY_BREAK
+case 93:
+YY_RULE_SETUP
+#line 201 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(rintopsym); return rintopsym; }
+	YY_BREAK
+case 94:
+YY_RULE_SETUP
+#line 202 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(icntopsym); return icntopsym; }
+	YY_BREAK
+case 95:
+YY_RULE_SETUP
+#line 203 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(clockopsym); return clockopsym; }
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+#line 204 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(mcpyopsym); return mcpyopsym; }
+	YY_BREAK
+case 97:
+YY_RULE_SETUP
+#line 205 "asm_lexer.l"
+{ BEGIN INSTRUCTION; tok2ast(msetopsym); return msetopsym; }
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 207 "asm_lexer.l"
+{ BEGIN DATADECL; tok2ast(wordsym); return wordsym; }
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+#line 209 "asm_lexer.l"
+{ tok2ast(plussym); return plussym; }
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 210 "asm_lexer.l"
+{ tok2ast(minussym); return minussym; }
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+#line 211 "asm_lexer.l"
+{ return commasym; }
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+#line 213 "asm_lexer.l"
+{ tok2ast(dottextsym); return dottextsym; }
+	YY_BREAK
+case 103:
+YY_RULE_SETUP
+#line 214 "asm_lexer.l"
+{ tok2ast(dotdatasym); return dotdatasym; }
+	YY_BREAK
+case 104:
+YY_RULE_SETUP
+#line 215 "asm_lexer.l"
+{ tok2ast(dotstacksym); return dotstacksym; }
+	YY_BREAK
+case 105:
+YY_RULE_SETUP
+#line 216 "asm_lexer.l"
+{ return dotendsym; }
+	YY_BREAK
+case 106:
+YY_RULE_SETUP
+#line 217 "asm_lexer.l"
+{ tok2ast(equalsym); return equalsym; }
+	YY_BREAK
+case 107:
+YY_RULE_SETUP
+#line 218 "asm_lexer.l"
+{ return colonsym; }
+	YY_BREAK
+case 108:
+YY_RULE_SETUP
+#line 220 "asm_lexer.l"
 { unsigned int val;
                   int ssf_ret;
                   if (yyleng >= 2 && (strncmp(yytext, "0x", 2) == 0)) {
@@ -1257,175 +1620,175 @@ YY_RULE_SETUP
                   return unsignednumsym; 
                 }
 	YY_BREAK
-case 52:
+case 109:
 YY_RULE_SETUP
-#line 183 "asm_lexer.l"
+#line 240 "asm_lexer.l"
 { reg2ast(yytext+1); return regsym; }
 	YY_BREAK
-case 53:
+case 110:
 YY_RULE_SETUP
-#line 184 "asm_lexer.l"
+#line 241 "asm_lexer.l"
 { namedreg2ast(1,yytext); return regsym; }
 	YY_BREAK
-case 54:
+case 111:
 YY_RULE_SETUP
-#line 185 "asm_lexer.l"
+#line 242 "asm_lexer.l"
 { namedreg2ast(2,yytext); return regsym; }
 	YY_BREAK
-case 55:
+case 112:
 YY_RULE_SETUP
-#line 186 "asm_lexer.l"
+#line 243 "asm_lexer.l"
 { namedreg2ast(3,yytext); return regsym; }
 	YY_BREAK
-case 56:
+case 113:
 YY_RULE_SETUP
-#line 187 "asm_lexer.l"
+#line 244 "asm_lexer.l"
 { namedreg2ast(4,yytext); return regsym; }
 	YY_BREAK
-case 57:
+case 114:
 YY_RULE_SETUP
-#line 188 "asm_lexer.l"
+#line 245 "asm_lexer.l"
 { namedreg2ast(5,yytext); return regsym; }
 	YY_BREAK
-case 58:
+case 115:
 YY_RULE_SETUP
-#line 189 "asm_lexer.l"
+#line 246 "asm_lexer.l"
 { namedreg2ast(6,yytext); return regsym; }
 	YY_BREAK
-case 59:
+case 116:
 YY_RULE_SETUP
-#line 190 "asm_lexer.l"
+#line 247 "asm_lexer.l"
 { namedreg2ast(7,yytext); return regsym; }
 	YY_BREAK
-case 60:
+case 117:
 YY_RULE_SETUP
-#line 191 "asm_lexer.l"
+#line 248 "asm_lexer.l"
 { namedreg2ast(8,yytext); return regsym; }
 	YY_BREAK
-case 61:
+case 118:
 YY_RULE_SETUP
-#line 192 "asm_lexer.l"
+#line 249 "asm_lexer.l"
 { namedreg2ast(9,yytext); return regsym; }
 	YY_BREAK
-case 62:
+case 119:
 YY_RULE_SETUP
-#line 193 "asm_lexer.l"
+#line 250 "asm_lexer.l"
 { namedreg2ast(10,yytext); return regsym; }
 	YY_BREAK
-case 63:
+case 120:
 YY_RULE_SETUP
-#line 194 "asm_lexer.l"
+#line 251 "asm_lexer.l"
 { namedreg2ast(11,yytext); return regsym; }
 	YY_BREAK
-case 64:
+case 121:
 YY_RULE_SETUP
-#line 195 "asm_lexer.l"
+#line 252 "asm_lexer.l"
 { namedreg2ast(12,yytext); return regsym; }
 	YY_BREAK
-case 65:
+case 122:
 YY_RULE_SETUP
-#line 196 "asm_lexer.l"
+#line 253 "asm_lexer.l"
 { namedreg2ast(13,yytext); return regsym; }
 	YY_BREAK
-case 66:
+case 123:
 YY_RULE_SETUP
-#line 197 "asm_lexer.l"
+#line 254 "asm_lexer.l"
 { namedreg2ast(14,yytext); return regsym; }
 	YY_BREAK
-case 67:
+case 124:
 YY_RULE_SETUP
-#line 198 "asm_lexer.l"
+#line 255 "asm_lexer.l"
 { namedreg2ast(15,yytext); return regsym; }
 	YY_BREAK
-case 68:
+case 125:
 YY_RULE_SETUP
-#line 199 "asm_lexer.l"
+#line 256 "asm_lexer.l"
 { namedreg2ast(16,yytext); return regsym; }
 	YY_BREAK
-case 69:
+case 126:
 YY_RULE_SETUP
-#line 200 "asm_lexer.l"
+#line 257 "asm_lexer.l"
 { namedreg2ast(17,yytext); return regsym; }
 	YY_BREAK
-case 70:
+case 127:
 YY_RULE_SETUP
-#line 201 "asm_lexer.l"
+#line 258 "asm_lexer.l"
 { namedreg2ast(18,yytext); return regsym; }
 	YY_BREAK
-case 71:
+case 128:
 YY_RULE_SETUP
-#line 202 "asm_lexer.l"
+#line 259 "asm_lexer.l"
 { namedreg2ast(19,yytext); return regsym; }
 	YY_BREAK
-case 72:
+case 129:
 YY_RULE_SETUP
-#line 203 "asm_lexer.l"
+#line 260 "asm_lexer.l"
 { namedreg2ast(20,yytext); return regsym; }
 	YY_BREAK
-case 73:
+case 130:
 YY_RULE_SETUP
-#line 204 "asm_lexer.l"
+#line 261 "asm_lexer.l"
 { namedreg2ast(21,yytext); return regsym; }
 	YY_BREAK
-case 74:
+case 131:
 YY_RULE_SETUP
-#line 205 "asm_lexer.l"
+#line 262 "asm_lexer.l"
 { namedreg2ast(22,yytext); return regsym; }
 	YY_BREAK
-case 75:
+case 132:
 YY_RULE_SETUP
-#line 206 "asm_lexer.l"
+#line 263 "asm_lexer.l"
 { namedreg2ast(23,yytext); return regsym; }
 	YY_BREAK
-case 76:
+case 133:
 YY_RULE_SETUP
-#line 207 "asm_lexer.l"
+#line 264 "asm_lexer.l"
 { namedreg2ast(24,yytext); return regsym; }
 	YY_BREAK
-case 77:
+case 134:
 YY_RULE_SETUP
-#line 208 "asm_lexer.l"
+#line 265 "asm_lexer.l"
 { namedreg2ast(25,yytext); return regsym; }
 	YY_BREAK
-case 78:
+case 135:
 YY_RULE_SETUP
-#line 209 "asm_lexer.l"
+#line 266 "asm_lexer.l"
 { namedreg2ast(28,yytext); return regsym; }
 	YY_BREAK
-case 79:
+case 136:
 YY_RULE_SETUP
-#line 210 "asm_lexer.l"
+#line 267 "asm_lexer.l"
 { namedreg2ast(29,yytext); return regsym; }
 	YY_BREAK
-case 80:
+case 137:
 YY_RULE_SETUP
-#line 211 "asm_lexer.l"
+#line 268 "asm_lexer.l"
 { namedreg2ast(30,yytext); return regsym; }
 	YY_BREAK
-case 81:
+case 138:
 YY_RULE_SETUP
-#line 212 "asm_lexer.l"
+#line 269 "asm_lexer.l"
 { namedreg2ast(31,yytext); return regsym; }
 	YY_BREAK
-case 82:
+case 139:
 YY_RULE_SETUP
-#line 214 "asm_lexer.l"
+#line 271 "asm_lexer.l"
 { ident2ast(yytext); return identsym; }
 	YY_BREAK
-case 83:
+case 140:
 YY_RULE_SETUP
-#line 216 "asm_lexer.l"
+#line 273 "asm_lexer.l"
 { char msgbuf[512];
       sprintf(msgbuf, "invalid character: '%c' ('\\0%o')", *yytext, *yytext);
       yyerror(lexer_filename(), msgbuf);
     }
 	YY_BREAK
-case 84:
+case 141:
 YY_RULE_SETUP
-#line 220 "asm_lexer.l"
+#line 277 "asm_lexer.l"
 ECHO;
 	YY_BREAK
-#line 1428 "asm_lexer.c"
+#line 1791 "asm_lexer.c"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(INSTRUCTION):
 case YY_STATE_EOF(DATADECL):
@@ -1724,7 +2087,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 173 )
+			if ( yy_current_state >= 304 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1752,11 +2115,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 173 )
+		if ( yy_current_state >= 304 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 172);
+	yy_is_jam = (yy_current_state == 303);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2444,7 +2807,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 220 "asm_lexer.l"
+#line 277 "asm_lexer.l"
 
 
 /* Requires: fname != NULL
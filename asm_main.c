@@ -41,11 +41,12 @@ char * cmdname;
 static const char *typicalFile = "file.asm";
 
 void usage() {
-    bail_with_error("Usage: %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s",
+    bail_with_error("Usage: %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s\n       %s %s %s",
 		    cmdname, typicalFile,
 		    cmdname, "-l", typicalFile,
 		    cmdname, "-u", typicalFile,
-		    cmdname, "-s", typicalFile);
+		    cmdname, "-s", typicalFile,
+		    cmdname, "-c", typicalFile);
     exit(EXIT_FAILURE);
 }
 
@@ -66,7 +67,7 @@ int main(int argc, char *argv[]) {
     argc--;
     argv++;
 
-    // possible options: -l, -u, and -s
+    // possible options: -l, -u, -s, and -c (compress the text section)
     while (argc > 0 && strlen(argv[0]) >= 2 && argv[0][0] == '-') {
 	if (strcmp(argv[0],"-l") == 0) {
 	    lexer_print_output = true;
@@ -80,6 +81,10 @@ int main(int argc, char *argv[]) {
 	    symbol_table_print = true;
 	    argc--;
 	    argv++;
+	} else if (strcmp(argv[0],"-c") == 0) {
+	    assemble_set_compression(true);
+	    argc--;
+	    argv++;
 	} else {
 	    // bad option!
 	    usage();
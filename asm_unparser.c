@@ -79,16 +79,25 @@ void unparseInstr(FILE *out, instr_t instr)
 
     // print any registers used
     int i = 0;
-    if (instr.opcode == REG_O) {
+    if (instr.opcode == LUI_O) {
+	// this uses only the second (rt) register
+	i = 1;
+    } else if (instr.opcode == REG_O) {
 	switch (instr.func) {
 	case MFHI_F: case MFLO_F:
 	    // these use only the third (rd) register	    
 	    i = 2;
 	    break;
-	case SLL_F: case SRL_F:
+	case SLL_F: case SRL_F: case SRA_F:
 	    // these use only the second (rt) and third (rd) registers
 	    i = 1;
 	    break;
+	case JALR_F: case CVTSW_F: case CVTWS_F:
+	    // these use only the first (rs) and third (rd) registers
+	    unparseReg(out, instr.regs[0]);
+	    fprintf(out, ", ");
+	    i = 2;
+	    break;
 	default:
 	    // all the rest start with the rs register
 	    i = 0;
@@ -115,7 +124,10 @@ void unparseInstr(FILE *out, instr_t instr)
 	fprintf(out, "0x%hx", instr.immed_data.data.uimmed);
 	break;
     case ik_syscall_code:
-	// no arguments for system calls!
+	// no arguments for system calls, except plugins' codes
+	if (instr.immed_data.data.syscall_code >= PLUGIN_FIRST_SYSCALL) {
+	    fprintf(out, "%u", instr.immed_data.data.syscall_code);
+	}
 	break;
     case ik_offset:
 	unparseLora(out, instr.immed_data.data.lora);
@@ -177,7 +189,11 @@ void unparseIdent(FILE *out, ident_t id)
 // Unparse the given AST, with output going to out
 void unparseInitializer(FILE *out, initializer_t init)
 {
-    fprintf(out, "= %d", init.number);
+    if (init.label != NULL) {
+	fprintf(out, "= %s", init.label);
+    } else {
+	fprintf(out, "= %d", init.number);
+    }
 }
 
 // Unparse the given AST, with output going to out
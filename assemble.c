@@ -9,6 +9,16 @@
 #include "id_attrs.h"
 #include "regname.h"
 
+// Should instructions be written in compressed form?
+static bool compression = false;
+
+// Set whether instructions are written in their compressed (16-bit)
+// forms, when they have them (this is off by default)
+void assemble_set_compression(bool compress)
+{
+    compression = compress;
+}
+
 // Return the address associated with the lora l
 static address_type assemble_lora2address(lora_t l)
 {
@@ -27,7 +37,7 @@ static address_type assemble_lora2address(lora_t l)
 void assembleProgram(BOFFILE bf, program_t prog)
 {
     BOFHeader bh;
-    strcpy(bh.magic, "BOF");
+    strcpy(bh.magic, compression ? BOF_COMPRESSED_MAGIC : BOF_MAGIC);
     bh.text_start_address = assemble_lora2address(prog.textSection.entryPoint);
     bh.text_length = BYTES_PER_WORD
 	* ast_list_length(prog.textSection.instrs.instrs);
@@ -37,6 +47,18 @@ void assembleProgram(BOFFILE bf, program_t prog)
     bh.stack_bottom_addr = prog.stackSection.stack_bottom_addr;
     bof_write_header(bf, bh);
     assembleTextSection(bf, prog.textSection);
+    if (compression) {
+	// the text's length is only known now, so rewrite the header
+	long text_end = ftell(bf.fileptr);
+	bh.text_length = text_end - sizeof(BOFHeader);
+	if (fseek(bf.fileptr, 0, SEEK_SET) != 0) {
+	    bail_with_error("Cannot rewrite header of %s", bf.filename);
+	}
+	bof_write_header(bf, bh);
+	if (fseek(bf.fileptr, text_end, SEEK_SET) != 0) {
+	    bail_with_error("Cannot seek in %s", bf.filename);
+	}
+    }
     assembleDataSection(bf, prog.dataSection);
     // nothing to do for the stack section, it's all in the header
 }
@@ -101,6 +123,18 @@ static int immedData_value(immedData_t immed)
     return ret;
 }
 
+// If compression is on and bi has a compressed form,
+// write that to bf and return true, otherwise return false
+static bool assemble_write_compressed(BOFFILE bf, bin_instr_t bi)
+{
+    compressed_instr_t ci;
+    if (!compression || !instruction_compress(bi, &ci)) {
+	return false;
+    }
+    instruction_write_compressed(bf, ci);
+    return true;
+}
+
 // Assemble the code for the given AST, with output going to bf
 void assembleInstr(BOFFILE bf, instr_t instr)
 {
@@ -111,7 +145,9 @@ void assembleInstr(BOFFILE bf, instr_t instr)
 	si.op = REG_O;
 	si.code = immedData_value(instr.immed_data);
 	si.func = SYSCALL_F;
-	instruction_write_syscallInstr(bf, si);
+	if (!assemble_write_compressed(bf, (bin_instr_t) { .syscall = si })) {
+	    instruction_write_syscallInstr(bf, si);
+	}
 	break;
     case reg_instr_type:
 	reg_instr_t ri;
@@ -120,12 +156,14 @@ void assembleInstr(BOFFILE bf, instr_t instr)
 	ri.rs = instr.regs[0];
 	ri.rt = instr.regs[1];
 	ri.rd = instr.regs[2];
-	if (ri.func == SLL_F || ri.func == SRL_F) {
+	if (ri.func == SLL_F || ri.func == SRL_F || ri.func == SRA_F) {
 	    ri.shift = immedData_value(instr.immed_data);
 	} else {
 	    ri.shift = 0;
 	}
-	instruction_write_regInstr(bf, ri);
+	if (!assemble_write_compressed(bf, (bin_instr_t) { .reg = ri })) {
+	    instruction_write_regInstr(bf, ri);
+	}
 	break;
     case immed_instr_type:
 	immed_instr_t ii;
@@ -133,7 +171,9 @@ void assembleInstr(BOFFILE bf, instr_t instr)
 	ii.rs = instr.regs[0];
 	ii.rt = instr.regs[1];
 	ii.immed = immedData_value(instr.immed_data);
-	instruction_write_immedInstr(bf, instr.opcode, ii);
+	if (!assemble_write_compressed(bf, (bin_instr_t) { .immed = ii })) {
+	    instruction_write_immedInstr(bf, instr.opcode, ii);
+	}
 	break;
     case jump_instr_type:
 	jump_instr_t ji;
@@ -150,21 +190,39 @@ void assembleInstr(BOFFILE bf, instr_t instr)
 // Assemble the code for the given AST, with output going to bf
 void assembleDataSection(BOFFILE bf, data_section_t ds)
 {
-    assembleStaticDecls(bf, ds.staticDecls);
+    assembleStaticDecls(bf, ds.staticDecls, ds.static_start_addr);
 }
 
 // Assemble the code for the given AST, with output going to bf
-void assembleStaticDecls(BOFFILE bf, static_decls_t sds)
+// (static_start is the address of the data section)
+void assembleStaticDecls(BOFFILE bf, static_decls_t sds,
+			 address_type static_start)
 {
     static_decl_t *dcl = sds.decls;
     while (dcl != NULL) {
-	assembleStaticDecl(bf, *dcl);
+	assembleStaticDecl(bf, *dcl, static_start);
 	dcl = dcl->next;
     }
 }
 
 // Assemble the code for the given AST, with output going to bf
-void assembleStaticDecl(BOFFILE bf, static_decl_t dcl)
+// (static_start is the address of the data section)
+void assembleStaticDecl(BOFFILE bf, static_decl_t dcl,
+			address_type static_start)
 {
-    bof_write_word(bf, dcl.initializer.number);
+    word_type value = dcl.initializer.number;
+    if (dcl.initializer.label != NULL) {
+	// the byte address of the instruction or data the label names
+	id_attrs *ida = symtab_lookup(dcl.initializer.label);
+	if (ida == NULL) {
+	    bail_with_error("Label \"%s\" never defined!",
+			    dcl.initializer.label);
+	}
+	if (ida->kind == id_label) {
+	    value = BYTES_PER_WORD * ida->addr;
+	} else {
+	    value = static_start + ida->addr;
+	}
+    }
+    bof_write_word(bf, value);
 }
@@ -5,6 +5,10 @@
 #include "ast.h"
 #include "bof.h"
 
+// Set whether instructions are written in their compressed (16-bit)
+// forms, when they have them (this is off by default)
+extern void assemble_set_compression(bool compress);
+
 // Generate code for prog, with output going to the file out
 extern void assembleProgram(BOFFILE bf, program_t prog);
 
@@ -36,10 +40,14 @@ extern void assembleReg(BOFFILE bf, short unsigned n);
 extern void assembleDataSection(BOFFILE bf, data_section_t ds);
 
 // Unparse the given AST, with output going to bf
-extern void assembleStaticDecls(BOFFILE bf, static_decls_t sds);
+// (static_start is the address of the data section)
+extern void assembleStaticDecls(BOFFILE bf, static_decls_t sds,
+				address_type static_start);
 
 // Unparse the given AST, with output going to bf
-extern void assembleStaticDecl(BOFFILE bf, static_decl_t dcl);
+// (static_start is the address of the data section)
+extern void assembleStaticDecl(BOFFILE bf, static_decl_t dcl,
+			       address_type static_start);
 
 // Unparse the given AST, with output going to bf
 extern void assembleIdent(BOFFILE bf, ident_t id);
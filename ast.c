@@ -139,6 +139,67 @@ asm_instrs_t ast_asm_instrs_add(asm_instrs_t lst, asm_instr_t asminstr)
     return ret;
 }
 
+// Return an AST made from adding the asm instrs in more to the end of lst
+asm_instrs_t ast_asm_instrs_append(asm_instrs_t lst, asm_instrs_t more)
+{
+    asm_instrs_t ret = lst;
+    asm_instr_t *last = ast_last_list_elem(lst.instrs);
+    if (last == NULL) {
+	ret.instrs = more.instrs;
+    } else {
+	last->next = more.instrs;
+    }
+    return ret;
+}
+
+// Return a token like op, but for the instruction with the given
+// token code and name (for instructions made by pseudo-instructions)
+static token_t ast_op_token(token_t op, int code, const char *name)
+{
+    token_t ret = ast_token(op.file_loc->filename, op.file_loc->line, code);
+    ret.text = name;
+    return ret;
+}
+
+// Return an AST for the instructions that the LI pseudo-instruction,
+// with the given label and op token, expands to: the shortest sequence
+// of ADDI, BORI and LUI instructions that puts value in register rt
+asm_instrs_t ast_load_immediate(label_opt_t labelOpt, token_t op,
+				unsigned short rt, word_type value)
+{
+    unsigned short upper = ((unsigned int) value) >> 16;
+    unsigned short lower = ((unsigned int) value) & 0xFFFF;
+    instr_t first;
+    bool or_lower = false;
+    if (-32768 <= value && value <= 32767) {
+	// ADDI $0, rt, value
+	first = ast_instr(ast_op_token(op, addiopsym, "ADDI"),
+			  immed_instr_type, 2, 0, rt, 0, 0,
+			  ik_immed, ast_immed_number(value));
+    } else if (upper == 0) {
+	// BORI $0, rt, value (as ADDI would sign extend it)
+	first = ast_instr(ast_op_token(op, boriopsym, "BORI"),
+			  immed_instr_type, 2, 0, rt, 0, 0,
+			  ik_uimmed, ast_immed_unsigned(lower));
+    } else {
+	// LUI rt, upper, followed by BORI rt, rt, lower if needed
+	first = ast_instr(ast_op_token(op, luiopsym, "LUI"),
+			  immed_instr_type, 2, 0, rt, 0, 0,
+			  ik_uimmed, ast_immed_unsigned(upper));
+	or_lower = (lower != 0);
+    }
+    asm_instrs_t ret = ast_asm_instrs_singleton(ast_asm_instr(labelOpt, first));
+    if (or_lower) {
+	instr_t second = ast_instr(ast_op_token(op, boriopsym, "BORI"),
+				   immed_instr_type, 2, rt, rt, 0, 0,
+				   ik_uimmed, ast_immed_unsigned(lower));
+	empty_t e = ast_empty(op.file_loc->filename, op.file_loc->line);
+	ret = ast_asm_instrs_add(ret,
+				 ast_asm_instr(ast_label_opt_empty(e), second));
+    }
+    return ret;
+}
+
 // Return an AST for a label_opt AST
 // with the given identifier
 label_opt_t ast_label_opt_label(ident_t id)
@@ -300,6 +361,18 @@ initializer_t ast_initializer_given(token_t eqs, word_type value)
     ret.file_loc = file_location_copy(eqs.file_loc);
     ret.type_tag = initializer_ast;
     ret.number = value;
+    ret.label = NULL;
+    return ret;
+}
+
+// Return an AST for an initializer with the address of the given label
+initializer_t ast_initializer_label(token_t eqs, ident_t label)
+{
+    initializer_t ret;
+    ret.file_loc = file_location_copy(eqs.file_loc);
+    ret.type_tag = initializer_ast;
+    ret.number = 0;
+    ret.label = label.name;
     return ret;
 }
 
@@ -321,6 +394,7 @@ extern initializer_t ast_initializer_empty(empty_t e)
     ret.file_loc = file_location_copy(e.file_loc);
     ret.type_tag = initializer_ast;
     ret.number = 0;
+    ret.label = NULL;
     return ret;
 }
 
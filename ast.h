@@ -154,11 +154,12 @@ typedef struct {
 } asm_instrs_t;
 
 // initializer-opt ::= initializer | empty
-// initializer ::= = number
+// initializer ::= = number | = label
 typedef struct {
     file_location *file_loc;
     AST_type type_tag;
     word_type number;
+    const char *label; // NULL unless initialized to a label's address
 } initializer_t;
 
 // staticDecl ::= dataSize ident initializer-opt
@@ -277,6 +278,16 @@ extern asm_instrs_t ast_asm_instrs_singleton(asm_instr_t asminstr);
 // Return an AST made from adding the given asm instr to the end of lst
 extern asm_instrs_t ast_asm_instrs_add(asm_instrs_t lst, asm_instr_t asminstr);
 
+// Return an AST made from adding the asm instrs in more to the end of lst
+extern asm_instrs_t ast_asm_instrs_append(asm_instrs_t lst,
+					  asm_instrs_t more);
+
+// Return an AST for the instructions that the LI pseudo-instruction,
+// with the given label and op token, expands to: the shortest sequence
+// of ADDI, BORI and LUI instructions that puts value in register rt
+extern asm_instrs_t ast_load_immediate(label_opt_t labelOpt, token_t op,
+				       unsigned short rt, word_type value);
+
 // Return an AST for a label_opt AST
 // with the given identifier
 extern label_opt_t ast_label_opt_label(ident_t id);
@@ -331,6 +342,9 @@ extern static_decl_t ast_static_decl(data_size_t ds,
 // Return an AST for an initializer with the given value
 extern initializer_t ast_initializer_given(token_t eqs, word_type value);
 
+// Return an AST for an initializer with the address of the given label
+extern initializer_t ast_initializer_label(token_t eqs, ident_t label);
+
 // Return an AST for an empty initializer 
 extern initializer_t ast_initializer_empty(empty_t e);
 
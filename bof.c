@@ -48,6 +48,12 @@ size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf) {
     return elems_read;
 }
 
+// Return whether the BOF file with header bh has a compressed text section
+bool bof_is_compressed(BOFHeader bh)
+{
+    return strncmp(bh.magic, BOF_COMPRESSED_MAGIC, MAGIC_BUFFER_SIZE) == 0;
+}
+
 // Requires: bf is open for reading in binary
 // Read the header of bf as a BOFHeader and return that header
 // If any errors are encountered, exit with an error message.
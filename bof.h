@@ -4,10 +4,16 @@
 #define _BOF_H
 #include <stdio.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include "machine_types.h"
 
 #define MAGIC_BUFFER_SIZE 4
 
+// magic numbers of BOF files, and of BOF files whose text section
+// is compressed (in which text_length is the compressed size in bytes)
+#define BOF_MAGIC "BOF"
+#define BOF_COMPRESSED_MAGIC "BOC"
+
 typedef struct { // Field magic should be "BOF" (with the null char)
     char     magic[MAGIC_BUFFER_SIZE];
     word_type text_start_address;  // byte address to start running (PC)
@@ -38,6 +44,9 @@ extern word_type bof_read_word(BOFFILE bf);
 // Read the given number of bytes into buf and return the number of bytes read
 size_t bof_read_bytes(BOFFILE bf, size_t bytes, void *buf);
 
+// Return whether the BOF file with header bh has a compressed text section
+extern bool bof_is_compressed(BOFHeader bh);
+
 // Requires: bf is open for reading in binary
 // Read the header of bf as a BOFHeader and return that header
 // If any errors are encountered, exit with an error message.
@@ -0,0 +1,151 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "console.h"
+#include "utilities.h"
+
+// Buffered output and the number of bytes in it
+static char buffer[CONSOLE_BUFFER_SIZE];
+static size_t used = 0;
+
+// Current policy and the number of buffered bytes that forces a flush
+static console_flush_policy flush_policy = flush_before_read;
+static size_t flush_threshold = CONSOLE_BUFFER_SIZE;
+
+// Whether console_flush has been registered to run at exit
+static bool registered = false;
+
+// Whether standard output is a terminal, as found by console_init
+static bool on_terminal = false;
+
+// Return the policy named by name, exiting with an error if there is none
+console_flush_policy console_policy_named(const char *name)
+{
+    if (strcmp(name, "exit") == 0)
+        return flush_on_exit;
+    if (strcmp(name, "newline") == 0)
+        return flush_on_newline;
+    if (strcmp(name, "size") == 0)
+        return flush_on_size;
+    if (strcmp(name, "read") == 0)
+        return flush_before_read;
+    bail_with_error("Unknown flush policy: %s (use exit, newline, size or read)",
+                    name);
+    return flush_on_exit;
+}
+
+// Set the flush policy, and the threshold for the flush_on_size policy
+void console_init(console_flush_policy policy, size_t threshold)
+{
+    flush_policy = policy;
+    flush_threshold = CONSOLE_BUFFER_SIZE;
+    if (policy == flush_on_size && threshold > 0 && threshold < CONSOLE_BUFFER_SIZE)
+        flush_threshold = threshold;
+    // isatty sets errno when the answer is no, which is not an error here
+    int saved_errno = errno;
+    on_terminal = isatty(STDOUT_FILENO);
+    errno = saved_errno;
+    if (!registered)
+    {
+        atexit(console_flush);
+        on_bail(console_flush);
+        registered = true;
+    }
+}
+
+// Flush if the buffer has reached the threshold
+static inline void check_threshold()
+{
+    if (used >= flush_threshold)
+        console_flush();
+}
+
+// Buffer the character c for output and return it (as an unsigned char)
+int console_putc(int c)
+{
+    buffer[used++] = c;
+    if (c == '\n' && flush_policy == flush_on_newline)
+        console_flush();
+    else
+        check_threshold();
+    return (unsigned char)c;
+}
+
+// Buffer the null-terminated string s for output
+void console_puts(const char *s)
+{
+    console_write(s, strlen(s));
+}
+
+// Buffer the n bytes in buf for output
+void console_write(const char *buf, size_t n)
+{
+    while (n > 0)
+    {
+        size_t room = CONSOLE_BUFFER_SIZE - used;
+        size_t len = n < room ? n : room;
+        memcpy(buffer + used, buf, len);
+        used += len;
+        buf += len;
+        n -= len;
+        if (flush_policy == flush_on_newline && memchr(buf - len, '\n', len))
+            console_flush();
+        else
+            check_threshold();
+    }
+}
+
+// Buffer the n bytes in buf for output, ignoring the flush policy
+// (used for trace output, which is only written when the buffer fills)
+void console_write_raw(const char *buf, size_t n)
+{
+    while (n > 0)
+    {
+        size_t room = CONSOLE_BUFFER_SIZE - used;
+        size_t len = n < room ? n : room;
+        memcpy(buffer + used, buf, len);
+        used += len;
+        buf += len;
+        n -= len;
+        if (used == CONSOLE_BUFFER_SIZE)
+            console_flush();
+    }
+}
+
+// Return whether standard output is a terminal
+bool console_on_terminal()
+{
+    return on_terminal;
+}
+
+// Called before input is read, flushes under the flush_before_read policy
+void console_before_read()
+{
+    if (flush_policy == flush_before_read)
+        console_flush();
+}
+
+// Write all buffered output to standard output
+void console_flush()
+{
+    if (used == 0)
+        return;
+    // Anything already written with stdio comes first
+    fflush(stdout);
+    const char *p = buffer;
+    while (used > 0)
+    {
+        ssize_t wr = write(STDOUT_FILENO, p, used);
+        if (wr < 0 && errno == EINTR)
+            continue;
+        if (wr <= 0)
+            break;
+        p += wr;
+        used -= wr;
+    }
+    used = 0;
+}
@@ -0,0 +1,50 @@
+#ifndef _CONSOLE_H
+#define _CONSOLE_H
+#include <stdbool.h>
+#include <stddef.h>
+
+// Size of the console output buffer in bytes
+#define CONSOLE_BUFFER_SIZE 65536
+
+// Default threshold for the flush_on_size policy
+#define CONSOLE_DEFAULT_THRESHOLD 4096
+
+// When buffered console output is written to standard output
+// (it is always written when the buffer is full and when the VM exits)
+typedef enum
+{
+    flush_on_exit,     // only when full or at exit
+    flush_on_newline,  // after each newline
+    flush_on_size,     // when the threshold is reached
+    flush_before_read  // before reading input (for interactive use)
+} console_flush_policy;
+
+// Return the policy named by name, exiting with an error if there is none
+extern console_flush_policy console_policy_named(const char *name);
+
+// Set the flush policy, and the threshold for the flush_on_size policy
+extern void console_init(console_flush_policy policy, size_t threshold);
+
+// Buffer the character c for output and return it (as an unsigned char)
+extern int console_putc(int c);
+
+// Buffer the null-terminated string s for output
+extern void console_puts(const char *s);
+
+// Buffer the n bytes in buf for output
+extern void console_write(const char *buf, size_t n);
+
+// Buffer the n bytes in buf for output, ignoring the flush policy
+// (used for trace output, which is only written when the buffer fills)
+extern void console_write_raw(const char *buf, size_t n);
+
+// Return whether standard output is a terminal (known after console_init)
+extern bool console_on_terminal();
+
+// Called before input is read, flushes under the flush_before_read policy
+extern void console_before_read();
+
+// Write all buffered output to standard output
+extern void console_flush();
+
+#endif
@@ -24,7 +24,11 @@ void disasmTextSection(FILE *out, BOFFILE bf, BOFHeader bh)
 {
     fprintf(out, ".text %u", bh.text_start_address);
     newline(out);
-    disasmInstrs(out, bf, bh.text_length / BYTES_PER_WORD);
+    if (bof_is_compressed(bh)) {
+	disasmCompressedInstrs(out, bf, bh.text_length);
+    } else {
+	disasmInstrs(out, bf, bh.text_length / BYTES_PER_WORD);
+    }
 }
 
 // Disassemble length instructions from bf
@@ -36,6 +40,18 @@ void disasmInstrs(FILE *out, BOFFILE bf, int length)
     }
 }
 
+// Disassemble the compressed text section of length bytes from bf,
+// with output going to the file out
+void disasmCompressedInstrs(FILE *out, BOFFILE bf, int length)
+{
+    // instructions are expanded, so each goes at the next word's address
+    int bytes;
+    for (int i = 0; length > 0; i++, length -= bytes) {
+	disasmInstr(out, instruction_read_compressed(bf, &bytes),
+		    i*BYTES_PER_WORD);
+    }
+}
+
 // Disassemble the binary instruction bi, which would go at address i
 // each instruction has a label of the form a%d, where %d is the value of i
 void disasmInstr(FILE *out, bin_instr_t bi, unsigned int i)
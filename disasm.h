@@ -15,6 +15,10 @@ extern void disasmTextSection(FILE *out, BOFFILE bf, BOFHeader bh);
 // with output going to the file out
 extern void disasmInstrs(FILE *out, BOFFILE bf, int length);
 
+// Disassemble the compressed text section of length bytes from bf,
+// with output going to the file out
+extern void disasmCompressedInstrs(FILE *out, BOFFILE bf, int length);
+
 // Disassemble the binary instruction bi, which would go at address i
 // each instruction has a label of the form a%d, where %d is the value of i
 extern void disasmInstr(FILE *out, bin_instr_t bi, unsigned int i);
@@ -0,0 +1,183 @@
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hostfile.h"
+#include "utilities.h"
+
+// Directory that files are opened in, or -1 if there is no sandbox
+static int sandbox_fd = -1;
+
+// Host file descriptors of open files, indexed by handle less
+// HOSTFILE_FIRST_HANDLE (-1 for unused entries)
+static int files[HOSTFILE_MAX_FILES] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+// Allow access to the files below the directory dir
+// Exit the program with an error if it cannot be opened
+void hostfile_init(const char *dir)
+{
+    sandbox_fd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (sandbox_fd < 0)
+        bail_with_error("Cannot open sandbox directory %s", dir);
+}
+
+// Return the host file descriptor for handle, or -1 if it is not open
+static int host_fd(int handle)
+{
+    int i = handle - HOSTFILE_FIRST_HANDLE;
+    if (i < 0 || i >= HOSTFILE_MAX_FILES)
+        return -1;
+    return files[i];
+}
+
+// Open path below the sandbox with the given flags, one component at a time,
+// so that neither ".." nor a symbolic link can lead out of the sandbox
+// Return the host file descriptor, or -1 on error
+static int open_beneath(const char *path, int flags)
+{
+    char component[256];
+    int dir = sandbox_fd;
+    while (true)
+    {
+        size_t len = strcspn(path, "/");
+        if (len == 0 || len >= sizeof(component))
+            break;
+        memcpy(component, path, len);
+        component[len] = '\0';
+        if (strcmp(component, ".") == 0 || strcmp(component, "..") == 0)
+            break;
+
+        int fd;
+        if (path[len] == '\0')
+            fd = openat(dir, component, flags | O_NOFOLLOW, 0644);
+        else
+            fd = openat(dir, component, O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+        if (dir != sandbox_fd)
+            close(dir);
+        if (fd < 0 || path[len] == '\0')
+            return fd;
+        dir = fd;
+        path += len + 1;
+    }
+    if (dir != sandbox_fd)
+        close(dir);
+    return -1;
+}
+
+// Open the file at path (relative to the sandbox directory) with mode
+// Return its handle, or -1 if it cannot be opened or is outside the sandbox
+int hostfile_open(const char *path, int mode)
+{
+    int flags;
+    switch (mode)
+    {
+    case hostfile_read_mode:
+        flags = O_RDONLY;
+        break;
+    case hostfile_write_mode:
+        flags = O_WRONLY | O_CREAT | O_TRUNC;
+        break;
+    case hostfile_append_mode:
+        flags = O_WRONLY | O_CREAT | O_APPEND;
+        break;
+    default:
+        return -1;
+    }
+    if (sandbox_fd < 0)
+        return -1;
+
+    for (int i = 0; i < HOSTFILE_MAX_FILES; i++)
+    {
+        if (files[i] < 0)
+        {
+            files[i] = open_beneath(path, flags);
+            return files[i] < 0 ? -1 : i + HOSTFILE_FIRST_HANDLE;
+        }
+    }
+    return -1;
+}
+
+// Read at most n bytes from the file with the given handle into buf
+// Return the number of bytes read, or -1 on error
+int hostfile_read(int handle, void *buf, size_t n)
+{
+    int fd = host_fd(handle);
+    if (fd < 0)
+        return -1;
+    ssize_t rd;
+    while ((rd = read(fd, buf, n)) < 0 && errno == EINTR)
+        ;
+    return rd;
+}
+
+// Write n bytes from buf to the file with the given handle
+// Return the number of bytes written, or -1 on error
+int hostfile_write(int handle, const void *buf, size_t n)
+{
+    int fd = host_fd(handle);
+    if (fd < 0)
+        return -1;
+    size_t written = 0;
+    while (written < n)
+    {
+        ssize_t wr = write(fd, (const char *)buf + written, n - written);
+        if (wr < 0 && errno == EINTR)
+            continue;
+        if (wr <= 0)
+            return -1;
+        written += wr;
+    }
+    return written;
+}
+
+// Close the file with the given handle; return 0, or -1 on error
+int hostfile_close(int handle)
+{
+    int fd = host_fd(handle);
+    if (fd < 0)
+        return -1;
+    files[handle - HOSTFILE_FIRST_HANDLE] = -1;
+    return close(fd);
+}
+
+// Requires: addr is aligned to a host page
+// Map at most n bytes from the start of the file with the given handle
+// at addr, replacing the memory there (without copying the file).
+// The mapping is writable but private (copy on write), not read only,
+// since it replaces memory the program may store into; such stores
+// do not change the file.
+// Whole pages are mapped; the rest of the last page is zeroed.
+// Return the number of bytes of the file mapped, or -1 on error
+int hostfile_map(int handle, void *addr, size_t n)
+{
+    int fd = host_fd(handle);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        return -1;
+
+    // Only map pages that the file covers, as touching others would fault
+    if ((size_t)st.st_size < n)
+        n = st.st_size;
+    if (n == 0)
+        return 0;
+    void *p = mmap(addr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                   fd, 0);
+    if (p == MAP_FAILED)
+        return -1;
+
+    // The last page holds file bytes past n if the file is longer
+    size_t page = hostfile_page_size();
+    size_t mapped = (n + page - 1) / page * page;
+    memset((char *)addr + n, 0, mapped - n);
+    return (int)n;
+}
+
+// Return the size of a host page in bytes
+size_t hostfile_page_size()
+{
+    return sysconf(_SC_PAGESIZE);
+}
@@ -0,0 +1,51 @@
+#ifndef _HOSTFILE_H
+#define _HOSTFILE_H
+#include <stddef.h>
+
+// Maximum number of host files open at once
+#define HOSTFILE_MAX_FILES 16
+
+// Handle of the first host file (lower numbers are the standard files)
+#define HOSTFILE_FIRST_HANDLE 3
+
+// Modes for opening host files
+typedef enum
+{
+    hostfile_read_mode = 0,   // read only
+    hostfile_write_mode = 1,  // write only, created or truncated
+    hostfile_append_mode = 2  // write only, created, appended to
+} hostfile_mode;
+
+// Allow access to the files below the directory dir
+// Exit the program with an error if it cannot be opened
+extern void hostfile_init(const char *dir);
+
+// Open the file at path (relative to the sandbox directory) with mode
+// Return its handle, or -1 if it cannot be opened or is outside the sandbox
+extern int hostfile_open(const char *path, int mode);
+
+// Read at most n bytes from the file with the given handle into buf
+// Return the number of bytes read, or -1 on error
+extern int hostfile_read(int handle, void *buf, size_t n);
+
+// Write n bytes from buf to the file with the given handle
+// Return the number of bytes written, or -1 on error
+extern int hostfile_write(int handle, const void *buf, size_t n);
+
+// Close the file with the given handle; return 0, or -1 on error
+extern int hostfile_close(int handle);
+
+// Requires: addr is aligned to a host page
+// Map at most n bytes from the start of the file with the given handle
+// at addr, replacing the memory there (without copying the file).
+// The mapping is writable but private (copy on write), not read only,
+// since it replaces memory the program may store into; such stores
+// do not change the file.
+// Whole pages are mapped; the rest of the last page is zeroed.
+// Return the number of bytes of the file mapped, or -1 on error
+extern int hostfile_map(int handle, void *addr, size_t n);
+
+// Return the size of a host page in bytes
+extern size_t hostfile_page_size();
+
+#endif
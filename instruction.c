@@ -33,16 +33,26 @@ instr_type instruction_type(bin_instr_t i) {
     case ANDI_O:
     case BORI_O:
     case XORI_O:
+    case SLTI_O:
+    case SLTIU_O:
+    case LUI_O:
     case BEQ_O:
     case BGEZ_O:
     case BGTZ_O:
     case BLEZ_O:
     case BLTZ_O:
     case BNE_O:
+    case LOOP_O:
     case LBU_O:
     case LW_O:
     case SB_O:
     case SW_O:
+    case LWM_O:
+    case SWM_O:
+    case LB_O:
+    case LH_O:
+    case LHU_O:
+    case SH_O:
 	return immed_instr_type;
     default:
 	return error_instr_type;
@@ -63,6 +73,210 @@ bin_instr_t instruction_read(BOFFILE bf)
     return bi;
 }
 
+// Requires: bof is open for reading in binary
+// Read a single instruction, which may be compressed, from bf
+// and return it as a 32-bit instruction, setting *bytes to the number
+// of bytes read; but exit with an error if there is a problem.
+bin_instr_t instruction_read_compressed(BOFFILE bf, int *bytes)
+{
+    union {
+	compressed_instr_t ci;
+	bin_instr_t bi;
+	unsigned char buf[sizeof(bin_instr_t)];
+    } u;
+    size_t rd = fread(u.buf, sizeof(compressed_instr_t), 1, bf.fileptr);
+    if (rd != 1) {
+	bail_with_error("Cannot read instruction from %s", bf.filename);
+    }
+    if (u.ci.one.op >= FIRST_COMPRESSED_O) {
+	*bytes = sizeof(compressed_instr_t);
+	return instruction_expand(u.ci);
+    }
+    // otherwise it is the first part of a 32-bit instruction
+    rd = fread(u.buf + sizeof(compressed_instr_t),
+	       sizeof(bin_instr_t) - sizeof(compressed_instr_t), 1, bf.fileptr);
+    if (rd != 1) {
+	bail_with_error("Cannot read instruction from %s", bf.filename);
+    }
+    *bytes = sizeof(bin_instr_t);
+    return u.bi;
+}
+
+// Expand the compressed text section in the length bytes at text
+// into 32-bit instructions, storing them in instrs unless it is NULL;
+// return the number of instructions, or -1 if the text ends in the middle
+// of an instruction, has an unknown compressed op code, or expands to
+// more than max instructions (so an untrusted text can be checked)
+int instruction_expand_text(const unsigned char *text, int length,
+			    bin_instr_t instrs[], int max)
+{
+    int count = 0;
+    int pos = 0;
+    while (pos < length) {
+	union {
+	    compressed_instr_t ci;
+	    bin_instr_t bi;
+	} u;
+	int bytes = sizeof(compressed_instr_t);
+	if (pos + bytes > length || count >= max) {
+	    return -1;
+	}
+	memcpy(&u.ci, text + pos, bytes);
+	if (u.ci.one.op < FIRST_COMPRESSED_O) {
+	    // the first part of a 32-bit instruction
+	    bytes = sizeof(bin_instr_t);
+	    if (pos + bytes > length) {
+		return -1;
+	    }
+	    memcpy(&u.bi, text + pos, bytes);
+	} else if (u.ci.one.op > C_SYSCALL_O) {
+	    return -1;
+	} else {
+	    u.bi = instruction_expand(u.ci);
+	}
+	if (instrs != NULL) {
+	    instrs[count] = u.bi;
+	}
+	count++;
+	pos += bytes;
+    }
+    return count;
+}
+
+// Return the 32-bit immediate instruction with the given fields
+static bin_instr_t instruction_make_immed(op_code op, reg_num_type rs,
+					  reg_num_type rt,
+					  immediate_type immed)
+{
+    bin_instr_t bi;
+    bi.immed.op = op;
+    bi.immed.rs = rs;
+    bi.immed.rt = rt;
+    bi.immed.immed = immed;
+    return bi;
+}
+
+// Return the 32-bit register instruction with the given fields
+static bin_instr_t instruction_make_reg(func_code func, reg_num_type rs,
+					reg_num_type rt, reg_num_type rd)
+{
+    bin_instr_t bi;
+    bi.reg.op = REG_O;
+    bi.reg.rs = rs;
+    bi.reg.rt = rt;
+    bi.reg.rd = rd;
+    bi.reg.shift = 0;
+    bi.reg.func = func;
+    return bi;
+}
+
+// Return the sign extension of the low bits bits of v
+static int instruction_sgnExt(unsigned int v, int bits)
+{
+    unsigned int sign = 1u << (bits - 1);
+    return (int) (v ^ sign) - (int) sign;
+}
+
+// Return the 32-bit instruction that the compressed instruction ci stands for
+bin_instr_t instruction_expand(compressed_instr_t ci)
+{
+    bin_instr_t bi;
+    switch (ci.one.op) {
+    case C_JR_O:
+	bi = instruction_make_reg(JR_F, ci.one.value, 0, 0);
+	break;
+    case C_ADDISP_O:
+	bi = instruction_make_immed(ADDI_O, SP, SP,
+			BYTES_PER_WORD * instruction_sgnExt(ci.one.value, 10));
+	break;
+    case C_ADDI_O:
+	bi = instruction_make_immed(ADDI_O, ci.two.f1, ci.two.f1,
+				    instruction_sgnExt(ci.two.f2, 5));
+	break;
+    case C_LWSP_O:
+	bi = instruction_make_immed(LW_O, SP, ci.two.f1, ci.two.f2);
+	break;
+    case C_SWSP_O:
+	bi = instruction_make_immed(SW_O, SP, ci.two.f1, ci.two.f2);
+	break;
+    case C_MV_O:
+	bi = instruction_make_reg(ADD_F, 0, ci.two.f1, ci.two.f2);
+	break;
+    case C_SYSCALL_O:
+	bi.syscall.op = REG_O;
+	bi.syscall.code = ci.one.value;
+	bi.syscall.func = SYSCALL_F;
+	break;
+    default:
+	bail_with_error("Unknown compressed op code (%d) in instruction_expand!",
+			ci.one.op);
+	break;
+    }
+    return bi;
+}
+
+// If bi has a compressed form, then set *ci to it and return true,
+// otherwise return false
+bool instruction_compress(bin_instr_t bi, compressed_instr_t *ci)
+{
+    compressed_instr_t c;
+    switch (bi.immed.op) { // pretend it's an immediate instruction
+    case REG_O:
+	if (bi.reg.func == JR_F) {
+	    c.one.op = C_JR_O;
+	    c.one.value = bi.reg.rs;
+	} else if (bi.reg.func == SYSCALL_F) {
+	    c.one.op = C_SYSCALL_O;
+	    c.one.value = bi.syscall.code;
+	} else if (bi.reg.func == ADD_F) {
+	    c.two.op = C_MV_O;
+	    c.two.f1 = bi.reg.rt;
+	    c.two.f2 = bi.reg.rd;
+	} else {
+	    return false;
+	}
+	break;
+    case ADDI_O:
+	if (bi.immed.rs == SP && bi.immed.rt == SP) {
+	    c.one.op = C_ADDISP_O;
+	    c.one.value = ((short int) bi.immed.immed) / BYTES_PER_WORD;
+	} else {
+	    c.two.op = C_ADDI_O;
+	    c.two.f1 = bi.immed.rt;
+	    c.two.f2 = bi.immed.immed;
+	}
+	break;
+    case LW_O: case SW_O:
+	c.two.op = (bi.immed.op == LW_O) ? C_LWSP_O : C_SWSP_O;
+	c.two.f1 = bi.immed.rt;
+	c.two.f2 = bi.immed.immed;
+	break;
+    default:
+	return false;
+    }
+    // the fields above may have been truncated,
+    // so use c only if it stands for exactly the same instruction
+    wordAsInstr_t given, expanded;
+    given.bi = bi;
+    expanded.bi = instruction_expand(c);
+    if (given.w != expanded.w) {
+	return false;
+    }
+    *ci = c;
+    return true;
+}
+
+// Requires: bof is open for writing in binary
+// Write the compressed instruction ci to bf in binary,
+// but exit with an error if there is a problem.
+void instruction_write_compressed(BOFFILE bf, compressed_instr_t ci)
+{
+    size_t wr = fwrite(&ci, sizeof(ci), 1, bf.fileptr);
+    if (wr != 1) {
+	bail_with_error("Cannot write compressed instr to %s", bf.filename);
+    }
+}
+
 void instr_write_bin_instr(BOFFILE bf, bin_instr_t i)
 {
     size_t wr = fwrite(&i, sizeof(i), 1, bf.fileptr);
@@ -153,7 +367,55 @@ const char *instruction_syscall_mnemonic(unsigned int code)
     case stop_tracing_sc:
 	return "NOTR";
 	break;
+    case read_buf_sc:
+	return "RBUF";
+	break;
+    case write_buf_sc:
+	return "WBUF";
+	break;
+    case read_line_sc:
+	return "RLN";
+	break;
+    case file_open_sc:
+	return "FOPEN";
+	break;
+    case file_read_sc:
+	return "FREAD";
+	break;
+    case file_write_sc:
+	return "FWRITE";
+	break;
+    case file_close_sc:
+	return "FCLOSE";
+	break;
+    case file_map_sc:
+	return "FMAP";
+	break;
+    case print_int_sc:
+	return "PINT";
+	break;
+    case print_hex_sc:
+	return "PHEX";
+	break;
+    case read_int_sc:
+	return "RINT";
+	break;
+    case instr_count_sc:
+	return "ICNT";
+	break;
+    case clock_sc:
+	return "CLOCK";
+	break;
+    case memory_copy_sc:
+	return "MCPY";
+	break;
+    case memory_set_sc:
+	return "MSET";
+	break;
     default:
+	if (code >= PLUGIN_FIRST_SYSCALL) {
+	    return "SYSCALL";
+	}
 	bail_with_error("Unknown code (%d) in instruction_syscall_mnemonic",
 			code);
 	return "NEVERHAPPENS";
@@ -196,15 +458,105 @@ const char *instruction_func2name(bin_instr_t bi) {
     case XOR_F:
 	return "XOR";
 	break;
+    case SLT_F:
+	return "SLT";
+	break;
+    case SLTU_F:
+	return "SLTU";
+	break;
+    case MOVZ_F:
+	return "MOVZ";
+	break;
+    case MOVN_F:
+	return "MOVN";
+	break;
+    case LWX_F:
+	return "LWX";
+	break;
+    case SWX_F:
+	return "SWX";
+	break;
+    case LBUX_F:
+	return "LBUX";
+	break;
+    case SBX_F:
+	return "SBX";
+	break;
+    case PADDB_F:
+	return "PADDB";
+	break;
+    case PADDH_F:
+	return "PADDH";
+	break;
+    case PSUBB_F:
+	return "PSUBB";
+	break;
+    case PSUBH_F:
+	return "PSUBH";
+	break;
+    case PADDUSB_F:
+	return "PADDUSB";
+	break;
+    case PADDUSH_F:
+	return "PADDUSH";
+	break;
+    case PCMPEQB_F:
+	return "PCMPEQB";
+	break;
+    case PCMPEQH_F:
+	return "PCMPEQH";
+	break;
+    case PSELB_F:
+	return "PSELB";
+	break;
+    case FADD_F:
+	return "FADD";
+	break;
+    case FSUB_F:
+	return "FSUB";
+	break;
+    case FMUL_F:
+	return "FMUL";
+	break;
+    case FDIV_F:
+	return "FDIV";
+	break;
+    case FEQ_F:
+	return "FEQ";
+	break;
+    case FLT_F:
+	return "FLT";
+	break;
+    case FLE_F:
+	return "FLE";
+	break;
+    case CVTSW_F:
+	return "CVTSW";
+	break;
+    case CVTWS_F:
+	return "CVTWS";
+	break;
     case SLL_F:
 	return "SLL";
 	break;
     case SRL_F:
 	return "SRL";
 	break;
+    case SRA_F:
+	return "SRA";
+	break;
+    case SLLV_F:
+	return "SLLV";
+	break;
+    case SRLV_F:
+	return "SRLV";
+	break;
     case JR_F:
 	return "JR";
 	break;
+    case JALR_F:
+	return "JALR";
+	break;
     case SYSCALL_F:
 	return instruction_syscall_mnemonic(instruction_syscall_number(bi));
 	break;
@@ -234,6 +586,15 @@ const char *instruction_mnemonic(bin_instr_t i) {
     case XORI_O:
 	return "XORI";
 	break;
+    case SLTI_O:
+	return "SLTI";
+	break;
+    case SLTIU_O:
+	return "SLTIU";
+	break;
+    case LUI_O:
+	return "LUI";
+	break;
     case BEQ_O:
 	return "BEQ";
 	break;
@@ -252,6 +613,9 @@ const char *instruction_mnemonic(bin_instr_t i) {
     case BNE_O:
 	return "BNE";
 	break;
+    case LOOP_O:
+	return "LOOP";
+	break;
     case LBU_O:
 	return "LBU";
 	break;
@@ -264,6 +628,24 @@ const char *instruction_mnemonic(bin_instr_t i) {
     case SW_O:
 	return "SW";
 	break;
+    case LB_O:
+	return "LB";
+	break;
+    case LH_O:
+	return "LH";
+	break;
+    case LHU_O:
+	return "LHU";
+	break;
+    case SH_O:
+	return "SH";
+	break;
+    case LWM_O:
+	return "LWM";
+	break;
+    case SWM_O:
+	return "SWM";
+	break;
     case JMP_O:
 	return "JMP";
 	break;
@@ -313,11 +695,22 @@ const char *instruction_assembly_form(bin_instr_t instr) {
     instr_type it = instruction_type(instr);
     switch (it) {
     case syscall_instr_type:
-	// no arguments to these instructions, so nothing to do!
+	// no arguments to these instructions, except plugins' codes
+	if (instruction_syscall_number(instr) >= PLUGIN_FIRST_SYSCALL) {
+	    sprintf(buf, "%u", instruction_syscall_number(instr));
+	}
 	break;
     case reg_instr_type:
 	switch (instr.reg.func) {
 	case ADD_F: case SUB_F: case AND_F: case BOR_F: case NOR_F: case XOR_F:
+	case SLT_F: case SLTU_F: case SLLV_F: case SRLV_F:
+	case MOVZ_F: case MOVN_F:
+	case LWX_F: case SWX_F: case LBUX_F: case SBX_F:
+	case PADDB_F: case PADDH_F: case PSUBB_F: case PSUBH_F:
+	case PADDUSB_F: case PADDUSH_F: case PCMPEQB_F: case PCMPEQH_F:
+	case PSELB_F:
+	case FADD_F: case FSUB_F: case FMUL_F: case FDIV_F:
+	case FEQ_F: case FLT_F: case FLE_F:
 	    sprintf(buf, "%s, %s, %s",
 		    regname_get(instr.reg.rs),
 		    regname_get(instr.reg.rt),
@@ -331,7 +724,7 @@ const char *instruction_assembly_form(bin_instr_t instr) {
 	case MFHI_F: case MFLO_F:
 	    sprintf(buf, "%s", regname_get(instr.reg.rd));
 	    break;
-	case SLL_F: case SRL_F:
+	case SLL_F: case SRL_F: case SRA_F:
 	    sprintf(buf, "%s, %s, %hu",
 		    regname_get(instr.reg.rt),
 		    regname_get(instr.reg.rd),
@@ -340,6 +733,11 @@ const char *instruction_assembly_form(bin_instr_t instr) {
 	case JR_F:
 	    sprintf(buf, "%s", regname_get(instr.reg.rs));
 	    break;
+	case JALR_F: case CVTSW_F: case CVTWS_F:
+	    sprintf(buf, "%s, %s",
+		    regname_get(instr.reg.rs),
+		    regname_get(instr.reg.rd));
+	    break;
 	default:
 	    bail_with_error("Unknown register instruction function (%d)!",
 			    instr.reg.func);
@@ -348,7 +746,7 @@ const char *instruction_assembly_form(bin_instr_t instr) {
 	break;
     case immed_instr_type:
 	switch (instr.immed.op) {
-	case ADDI_O:
+	case ADDI_O: case SLTI_O: case SLTIU_O:
 	    sprintf(buf, "%s, %s, %hd",
 		    regname_get(instr.immed.rs),
 		    regname_get(instr.immed.rt),
@@ -360,6 +758,17 @@ const char *instruction_assembly_form(bin_instr_t instr) {
 		    regname_get(instr.immed.rt),
 		    instr.immed.immed);
 	    break;
+	case LUI_O:
+	    sprintf(buf, "%s, 0x%hx",
+		    regname_get(instr.immed.rt),
+		    instr.immed.immed);
+	    break;
+	case LWM_O: case SWM_O:
+	    sprintf(buf, "%s, %s, 0x%hx", // the mask is clearest in hex
+		    regname_get(instr.immed.rs),
+		    regname_get(instr.immed.rt),
+		    instr.immed.immed);
+	    break;
 	case BEQ_O: case BNE_O:
 	    sprintf(buf, "%s, %s, %hd\t%s",
 		    regname_get(instr.immed.rs),
@@ -368,11 +777,13 @@ const char *instruction_assembly_form(bin_instr_t instr) {
 		    instruction_offset_comment((short int) instr.immed.immed));
 	    break;
 	case BGEZ_O: case BGTZ_O: case BLEZ_O: case BLTZ_O:
+	case LOOP_O:
 	    sprintf(buf, "%s, %hd\t%s", regname_get(instr.immed.rs),
 		    (short int) instr.immed.immed,
 		    instruction_offset_comment((short int) instr.immed.immed));
 	    break;
 	case LBU_O: case LW_O: case SB_O: case SW_O:
+	case LB_O: case LH_O: case LHU_O: case SH_O:
 	    sprintf(buf, "%s, %s, %hd\t%s",
 		    regname_get(instr.immed.rs),
 		    regname_get(instr.immed.rt),
@@ -426,4 +837,5 @@ void instruction_check_sizes() {
     assert(sizeof(immed_instr_t) <= BYTES_PER_WORD);
     assert(sizeof(jump_instr_t) <= BYTES_PER_WORD);
     assert(sizeof(bin_instr_t) <= BYTES_PER_WORD);
+    assert(sizeof(compressed_instr_t) == BYTES_PER_WORD / 2);
 }    
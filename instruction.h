@@ -8,14 +8,31 @@
 
 // op codes in binary instructions for the SRM
 typedef enum {REG_O = 0, ADDI_O = 9, ANDI_O = 12, BORI_O = 13, XORI_O = 14,
+	      SLTI_O = 10, SLTIU_O = 11, LUI_O = 15,
 	      BEQ_O = 4, BGEZ_O = 1, BGTZ_O = 7, BLEZ_O = 6, BLTZ_O = 8,
-	      BNE_O = 5, LBU_O = 36, LW_O = 35, SB_O = 40, SW_O = 43,
+	      BNE_O = 5, LOOP_O = 20, LBU_O = 36, LW_O = 35, SB_O = 40, SW_O = 43,
+	      LWM_O = 46, SWM_O = 47,
+	      LB_O = 32, LH_O = 33, LHU_O = 37, SH_O = 41,
+	      // op codes from FIRST_COMPRESSED_O up are reserved (see below)
 	      JMP_O = 2, JAL_O = 3} op_code;
 
 // function codes in binary instructions for the SRM (when opcode is 0)
 typedef enum {ADD_F = 33, SUB_F = 35, MUL_F = 25, DIV_F = 27,
     MFHI_F = 16, MFLO_F = 18, AND_F = 36, BOR_F = 37, NOR_F = 39, XOR_F = 38,
-    SLL_F = 0, SRL_F = 3, JR_F = 8, SYSCALL_F = 12} func_code;
+    SLL_F = 0, SRL_F = 3, SRA_F = 2, SLLV_F = 4, SRLV_F = 6,
+    JR_F = 8, JALR_F = 9, SYSCALL_F = 12,
+    SLT_F = 42, SLTU_F = 43, MOVZ_F = 10, MOVN_F = 11,
+    // indexed loads and stores, at address rs + (scale * rt)
+    LWX_F = 44, SWX_F = 45, LBUX_F = 46, SBX_F = 47,
+    // packed (SIMD) instructions on byte (B) and halfword (H) lanes
+    PADDB_F = 48, PADDH_F = 49, PSUBB_F = 50, PSUBH_F = 51,
+    PADDUSB_F = 52, PADDUSH_F = 53, PCMPEQB_F = 54, PCMPEQH_F = 55,
+    PSELB_F = 56,
+    // single precision floating point, on the bit patterns in registers
+    FADD_F = 28, FSUB_F = 29, FMUL_F = 30, FDIV_F = 31,
+    FEQ_F = 20, FLT_F = 21, FLE_F = 22,
+    // conversions from word to single (CVTSW) and single to word (CVTWS)
+    CVTSW_F = 23, CVTWS_F = 24} func_code;
 
 // instruction types
 typedef enum {reg_instr_type, syscall_instr_type, immed_instr_type,
@@ -23,9 +40,22 @@ typedef enum {reg_instr_type, syscall_instr_type, immed_instr_type,
 
 // system calls
 typedef enum {exit_sc = 10, print_str_sc = 4, print_char_sc = 11,
-	      read_char_sc = 12, start_tracing_sc = 256, stop_tracing_sc = 257
+	      read_char_sc = 12, start_tracing_sc = 256, stop_tracing_sc = 257,
+	      read_buf_sc = 13, write_buf_sc = 14, read_line_sc = 15,
+	      file_open_sc = 16, file_read_sc = 17, file_write_sc = 18,
+	      file_close_sc = 19, file_map_sc = 20,
+	      print_int_sc = 21, print_hex_sc = 22, read_int_sc = 23,
+	      instr_count_sc = 24, clock_sc = 25,
+	      memory_copy_sc = 26, memory_set_sc = 27
 } syscall_type;
 
+// system call codes in the range
+// [PLUGIN_FIRST_SYSCALL, PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS)
+// are for native extensions (plugins),
+// written in assembly language as SYSCALL code
+#define PLUGIN_FIRST_SYSCALL 1024
+#define PLUGIN_MAX_SYSCALLS 1024
+
 // register/computational type instructions, except system calls
 typedef struct {
     unsigned short op : 6;  // opcode, 6 bits
@@ -71,6 +101,33 @@ typedef union wordAsInstr_u {
     bin_instr_t bi;
 } wordAsInstr_t;
 
+// op codes of compressed (16-bit) instructions, found only in the text
+// sections of compressed BOF files; each stands for one 32-bit instruction
+#define FIRST_COMPRESSED_O 56
+typedef enum {C_JR_O = 56,      // JR rs
+	      C_ADDISP_O = 57,  // ADDI $sp, $sp, 4 * (10-bit signed)
+	      C_ADDI_O = 58,    // ADDI rt, rt, (5-bit signed)
+	      C_LWSP_O = 59,    // LW $sp, rt, (5-bit unsigned offset)
+	      C_SWSP_O = 60,    // SW $sp, rt, (5-bit unsigned offset)
+	      C_MV_O = 61,      // ADD $0, rt, rd
+	      C_SYSCALL_O = 62  // system calls with codes below 1024
+} compressed_op_code;
+
+// compressed instructions, with two 5-bit fields or one 10-bit field
+// (the op field is in the first 2 bytes of all instructions,
+// so it tells whether an instruction in a file is compressed)
+typedef union {
+    struct {
+	unsigned short op : 6;  // opcode, 6 bits
+	unsigned short f1 : 5;  // register, 5 bits
+	unsigned short f2 : 5;  // register or immediate value, 5 bits
+    } two;
+    struct {
+	unsigned short op : 6;  // opcode, 6 bits
+	unsigned short value : 10;  // register, immediate or code, 10 bits
+    } one;
+} compressed_instr_t;
+
 // Return the type of the instruction given
 extern instr_type instruction_type(bin_instr_t i);
 
@@ -79,6 +136,32 @@ extern instr_type instruction_type(bin_instr_t i);
 // but exit with an error if there is a problem.
 extern bin_instr_t instruction_read(BOFFILE bf);
 
+// Requires: bof is open for reading in binary
+// Read a single instruction, which may be compressed, from bf
+// and return it as a 32-bit instruction, setting *bytes to the number
+// of bytes read; but exit with an error if there is a problem.
+extern bin_instr_t instruction_read_compressed(BOFFILE bf, int *bytes);
+
+// Expand the compressed text section in the length bytes at text
+// into 32-bit instructions, storing them in instrs unless it is NULL;
+// return the number of instructions, or -1 if the text ends in the middle
+// of an instruction, has an unknown compressed op code, or expands to
+// more than max instructions (so an untrusted text can be checked)
+extern int instruction_expand_text(const unsigned char *text, int length,
+				   bin_instr_t instrs[], int max);
+
+// If bi has a compressed form, then set *ci to it and return true,
+// otherwise return false
+extern bool instruction_compress(bin_instr_t bi, compressed_instr_t *ci);
+
+// Return the 32-bit instruction that the compressed instruction ci stands for
+extern bin_instr_t instruction_expand(compressed_instr_t ci);
+
+// Requires: bof is open for writing in binary
+// Write the compressed instruction ci to bf in binary,
+// but exit with an error if there is a problem.
+extern void instruction_write_compressed(BOFFILE bf, compressed_instr_t ci);
+
 // Requires: bof is open for writing in binary
 // Write the register instruction ri to bf in binary,
 // but exit with an error if there is a problem.
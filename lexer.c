@@ -75,12 +75,27 @@ op_code lexer_token2opcode(int toknum)
     case addopsym: case subopsym: case mulopsym: case divopsym:
     case mfhiopsym: case mfloopsym:
     case andopsym: case boropsym: case noropsym: case xoropsym:
-    case sllopsym: case srlopsym: case jropsym:
+    case sltopsym: case sltuopsym: case movzopsym: case movnopsym:
+    case lwxopsym: case swxopsym: case lbuxopsym: case sbxopsym:
+    case paddbopsym: case paddhopsym: case psubbopsym: case psubhopsym:
+    case paddusbopsym: case paddushopsym:
+    case pcmpeqbopsym: case pcmpeqhopsym: case pselbopsym:
+    case faddopsym: case fsubopsym: case fmulopsym: case fdivopsym:
+    case feqopsym: case fltopsym: case fleopsym:
+    case cvtswopsym: case cvtwsopsym:
+    case sllopsym: case srlopsym: case sraopsym:
+    case sllvopsym: case srlvopsym: case jropsym: case jalropsym:
 	ret = REG_O; // distinguished by func field
 	break;
     // system call op codes
     case exitopsym: case pstropsym: case pchopsym:
     case rchopsym: case straopsym: case notropsym:
+    case rbufopsym: case wbufopsym: case rlnopsym:
+    case fopenopsym: case freadopsym: case fwriteopsym:
+    case fcloseopsym: case fmapopsym: case syscallopsym:
+    case pintopsym: case phexopsym: case rintopsym:
+    case icntopsym: case clockopsym:
+    case mcpyopsym: case msetopsym:
 	ret = REG_O;  // opcode is REG_O, func SYSCALL_F, distinuished by code
 	break;
     // immedidate format op codes
@@ -96,6 +111,15 @@ op_code lexer_token2opcode(int toknum)
     case xoriopsym:
 	ret = XORI_O;
 	break;
+    case sltiopsym:
+	ret = SLTI_O;
+	break;
+    case sltiuopsym:
+	ret = SLTIU_O;
+	break;
+    case luiopsym:
+	ret = LUI_O;
+	break;
     case beqopsym:
 	ret = BEQ_O;
 	break;
@@ -114,6 +138,9 @@ op_code lexer_token2opcode(int toknum)
     case bneopsym:
 	ret = BNE_O;
 	break;
+    case loopopsym:
+	ret = LOOP_O;
+	break;
     case lbuopsym:
 	ret = LBU_O;
 	break;
@@ -126,6 +153,24 @@ op_code lexer_token2opcode(int toknum)
     case swopsym:
 	ret = SW_O;
 	break;
+    case lbopsym:
+	ret = LB_O;
+	break;
+    case lhopsym:
+	ret = LH_O;
+	break;
+    case lhuopsym:
+	ret = LHU_O;
+	break;
+    case shopsym:
+	ret = SH_O;
+	break;
+    case lwmopsym:
+	ret = LWM_O;
+	break;
+    case swmopsym:
+	ret = SWM_O;
+	break;
 	// jump format instructions
     case jmpopsym:
 	ret = JMP_O;
@@ -167,6 +212,84 @@ func_code lexer_token2func(int toknum)
     case xoropsym:
 	ret = XOR_F;
 	break;
+    case sltopsym:
+	ret = SLT_F;
+	break;
+    case sltuopsym:
+	ret = SLTU_F;
+	break;
+    case movzopsym:
+	ret = MOVZ_F;
+	break;
+    case movnopsym:
+	ret = MOVN_F;
+	break;
+    case lwxopsym:
+	ret = LWX_F;
+	break;
+    case swxopsym:
+	ret = SWX_F;
+	break;
+    case lbuxopsym:
+	ret = LBUX_F;
+	break;
+    case sbxopsym:
+	ret = SBX_F;
+	break;
+    case paddbopsym:
+	ret = PADDB_F;
+	break;
+    case paddhopsym:
+	ret = PADDH_F;
+	break;
+    case psubbopsym:
+	ret = PSUBB_F;
+	break;
+    case psubhopsym:
+	ret = PSUBH_F;
+	break;
+    case paddusbopsym:
+	ret = PADDUSB_F;
+	break;
+    case paddushopsym:
+	ret = PADDUSH_F;
+	break;
+    case pcmpeqbopsym:
+	ret = PCMPEQB_F;
+	break;
+    case pcmpeqhopsym:
+	ret = PCMPEQH_F;
+	break;
+    case pselbopsym:
+	ret = PSELB_F;
+	break;
+    case faddopsym:
+	ret = FADD_F;
+	break;
+    case fsubopsym:
+	ret = FSUB_F;
+	break;
+    case fmulopsym:
+	ret = FMUL_F;
+	break;
+    case fdivopsym:
+	ret = FDIV_F;
+	break;
+    case feqopsym:
+	ret = FEQ_F;
+	break;
+    case fltopsym:
+	ret = FLT_F;
+	break;
+    case fleopsym:
+	ret = FLE_F;
+	break;
+    case cvtswopsym:
+	ret = CVTSW_F;
+	break;
+    case cvtwsopsym:
+	ret = CVTWS_F;
+	break;
     case mulopsym:
 	ret = MUL_F;
 	break;
@@ -179,6 +302,18 @@ func_code lexer_token2func(int toknum)
     case srlopsym:
 	ret = SRL_F;
 	break;
+    case sraopsym:
+	ret = SRA_F;
+	break;
+    case jalropsym:
+	ret = JALR_F;
+	break;
+    case sllvopsym:
+	ret = SLLV_F;
+	break;
+    case srlvopsym:
+	ret = SRLV_F;
+	break;
     case mfhiopsym:
 	ret = MFHI_F;
 	break;
@@ -190,6 +325,12 @@ func_code lexer_token2func(int toknum)
 	break;
     case exitopsym: case pstropsym: case pchopsym:
     case rchopsym: case straopsym: case notropsym:
+    case rbufopsym: case wbufopsym: case rlnopsym:
+    case fopenopsym: case freadopsym: case fwriteopsym:
+    case fcloseopsym: case fmapopsym: case syscallopsym:
+    case pintopsym: case phexopsym: case rintopsym:
+    case icntopsym: case clockopsym:
+    case mcpyopsym: case msetopsym:
 	ret = SYSCALL_F;
 	break;
     default:
@@ -224,6 +365,51 @@ syscall_type lexer_token2syscall_code(int toknum)
     case notropsym:
 	ret = stop_tracing_sc;
 	break;
+    case rbufopsym:
+	ret = read_buf_sc;
+	break;
+    case wbufopsym:
+	ret = write_buf_sc;
+	break;
+    case rlnopsym:
+	ret = read_line_sc;
+	break;
+    case fopenopsym:
+	ret = file_open_sc;
+	break;
+    case freadopsym:
+	ret = file_read_sc;
+	break;
+    case fwriteopsym:
+	ret = file_write_sc;
+	break;
+    case fcloseopsym:
+	ret = file_close_sc;
+	break;
+    case fmapopsym:
+	ret = file_map_sc;
+	break;
+    case pintopsym:
+	ret = print_int_sc;
+	break;
+    case phexopsym:
+	ret = print_hex_sc;
+	break;
+    case rintopsym:
+	ret = read_int_sc;
+	break;
+    case icntopsym:
+	ret = instr_count_sc;
+	break;
+    case clockopsym:
+	ret = clock_sc;
+	break;
+    case mcpyopsym:
+	ret = memory_copy_sc;
+	break;
+    case msetopsym:
+	ret = memory_set_sc;
+	break;
     default:
 	bail_with_error("Unknown token (%d) given to lexer_token2syscall_code!",
 			toknum);
@@ -1,59 +1,427 @@
+#define _POSIX_C_SOURCE 200809L
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "assert.h"
+#include "console.h"
+#include "hostfile.h"
+#include "plugin.h"
+#include "simd.h"
 #include "machine.h"
 #include "machine_types.h"
 #include "trace.h"
 #include "utilities.h"
 
+// Report an error in the running program and exit; it is not an OS error,
+// so errno is cleared first (bail_with_error would report a stale one)
+#define program_error(...) (errno = 0, bail_with_error(__VA_ARGS__))
+
 // General purpose registers
 reg_type GPR[NUM_REGISTERS];
 
 // Program memory
-mem_u memory;
+_Alignas(MEMORY_PAGE_ALIGNMENT) mem_u memory;
 
 // Special purpose registers
 address_type PC;
 reg_type HI, LO;
 
+// Number of times memory was written (see memory_written),
+// and its value when each chunk of memory was last written
+static unsigned long memory_writes = 0;
+static unsigned long chunk_writes[MEMORY_CHUNKS];
+
 // Binary file
 BOFFILE bf;
 
+// View of the state above, handed out to tracing and other observers
+static const machine_view_t view = {GPR, &memory, &PC, &HI, &LO,
+                                    &memory_writes};
+
 // Binary header object
 BOFHeader bh;
 
 // Whether tracing is currently activated
 bool tracing_active = true;
 
+// Number of instructions executed before the current basic block;
+// instructions are counted a whole block at a time when control transfers
+unsigned long long instr_count = 0;
+
+// Address of the first instruction of the current basic block
+address_type block_start;
+
+// Execution limits (0 means no limit) and when the watchdog next checks them
+unsigned long long max_instrs = 0;
+unsigned long max_ms = 0;
+unsigned long long next_check = ULLONG_MAX;
+
+// Time when execution started, for the wall clock limit
+struct timespec exec_start;
+
+// Record that the length bytes at addr were written
+// (every write to memory must be recorded, so observers can rely on it)
+static inline void memory_written(int addr, int length)
+{
+    memory_writes++;
+    if (length <= 0)
+        return;
+    int last = (addr + length - 1) / MEMORY_CHUNK_SIZE;
+    for (int c = addr / MEMORY_CHUNK_SIZE; c <= last; c++)
+        chunk_writes[c] = memory_writes;
+}
+
 // Initialize machine state from binary object file
 void machine_init(const char *filename)
 {
-    // Open binary object file and read header
+    // Open binary object file and load it
     bf = bof_read_open(filename);
+    machine_load(bf);
+}
+
+// Load machine state from an open binary object file
+void machine_load(BOFFILE bof)
+{
+    // Read header
+    bf = bof;
     bh = bof_read_header(bf);
 
-    // Initialize memory and registers to 0
-    memset(&memory, 0, bh.stack_bottom_addr + BYTES_PER_WORD);
+    // Initialize memory and registers to 0; all of memory is cleared,
+    // as vmd loads each image over the one it loaded before
+    memset(&memory, 0, sizeof(memory));
     memset(GPR, 0, BYTES_PER_WORD * NUM_REGISTERS);
 
-    // Load instructions
+    // Load instructions, expanding them if they are compressed
     const int text_start_index = bh.text_start_address / BYTES_PER_WORD;
-    for (int i = 0; i < bh.text_length / BYTES_PER_WORD; i++)
-        memory.instrs[text_start_index + i] = instruction_read(bf);
+    if (bof_is_compressed(bh))
+    {
+        if (bh.text_length < 0 || bh.text_length > MEMORY_SIZE_IN_BYTES ||
+            text_start_index < 0 || text_start_index > MEMORY_SIZE_IN_WORDS)
+            program_error("Compressed text in %s does not fit in memory",
+                          bf.filename);
+        unsigned char *text = malloc(bh.text_length + 1);
+        if (text == NULL)
+            bail_with_error("Cannot allocate text of %s", bf.filename);
+        if (fread(text, 1, bh.text_length, bf.fileptr) != (size_t)bh.text_length)
+            bail_with_error("Cannot read text from %s", bf.filename);
+        int count = instruction_expand_text(text, bh.text_length,
+                                            &memory.instrs[text_start_index],
+                                            MEMORY_SIZE_IN_WORDS - text_start_index);
+        free(text);
+        if (count < 0)
+            program_error("Compressed text in %s is not valid", bf.filename);
+        // From here on the header describes the text as it was loaded
+        strcpy(bh.magic, BOF_MAGIC);
+        bh.text_length = count * BYTES_PER_WORD;
+    }
+    else
+    {
+        for (int i = 0; i < bh.text_length / BYTES_PER_WORD; i++)
+            memory.instrs[text_start_index + i] = instruction_read(bf);
+    }
 
     // Load data
     const int data_start_index = bh.data_start_address / BYTES_PER_WORD;
     for (int i = 0; i < bh.data_length / BYTES_PER_WORD; i++)
         memory.words[data_start_index + i] = bof_read_word(bf);
 
+    memory_written(0, MEMORY_SIZE_IN_BYTES);
+
     // Set initial register values
     GPR[GP] = bh.data_start_address;
     GPR[FP] = GPR[SP] = bh.stack_bottom_addr;
     PC = bh.text_start_address;
 }
 
+// Save the loaded program (header and initial memory) into image
+void machine_save_image(machine_image_t *image)
+{
+    image->header = bh;
+    memcpy(&image->memory, &memory, sizeof(mem_u));
+}
+
+// Reset machine state to the start of the program saved in image
+void machine_restore_image(const machine_image_t *image)
+{
+    bh = image->header;
+    memcpy(&memory, &image->memory, sizeof(mem_u));
+    memory_written(0, MEMORY_SIZE_IN_BYTES);
+    memset(GPR, 0, BYTES_PER_WORD * NUM_REGISTERS);
+    GPR[GP] = bh.data_start_address;
+    GPR[FP] = GPR[SP] = bh.stack_bottom_addr;
+    PC = bh.text_start_address;
+    HI = LO = 0;
+    instr_count = 0;
+    tracing_active = true;
+}
+
+// Return a view of the machine's state, which follows it as it runs
+const machine_view_t *machine_view()
+{
+    return &view;
+}
+
+// Return whether any of the length bytes at addr were written
+// since the machine view's memory_writes was equal to since
+bool machine_memory_written_since(int addr, int length, unsigned long since)
+{
+    if (length <= 0)
+        return false;
+    int last = (addr + length - 1) / MEMORY_CHUNK_SIZE;
+    if (last >= MEMORY_CHUNKS)
+        last = MEMORY_CHUNKS - 1;
+    for (int c = addr / MEMORY_CHUNK_SIZE; c <= last; c++)
+        if (chunk_writes[c] > since)
+            return true;
+    return false;
+}
+
+// Return the number of instructions executed so far
+unsigned long long machine_instr_count()
+{
+    return instr_count + (PC - block_start) / BYTES_PER_WORD;
+}
+
+// Load the plugin in the shared object at path, adding its system calls
+void machine_load_plugin(const char *path)
+{
+    plugin_load(path);
+}
+
+// Allow the program to access host files below the directory dir
+void machine_set_sandbox(const char *dir)
+{
+    hostfile_init(dir);
+}
+
+// Limit execution to max_instructions instructions and max_millis
+// milliseconds of wall clock time (0 means no limit)
+void machine_set_limits(unsigned long long max_instructions,
+                        unsigned long max_millis)
+{
+    max_instrs = max_instructions;
+    max_ms = max_millis;
+}
+
+// Return the number of milliseconds since execution started
+static unsigned long elapsed_ms()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - exec_start.tv_sec) * 1000 +
+           (now.tv_nsec - exec_start.tv_nsec) / 1000000;
+}
+
+// Report that the named limit was exceeded and exit
+static void limit_exceeded(const char *limit)
+{
+    console_flush();
+    fflush(stdout);
+    fprintf(stderr, "%s limit exceeded at PC %u after %llu instructions (%lu ms)\n",
+            limit, PC, machine_instr_count(), elapsed_ms());
+    fflush(stderr);
+    exit(MACHINE_LIMIT_EXIT_CODE);
+}
+
+// Check the execution limits, then schedule the next check
+static void watchdog_check()
+{
+    if (max_instrs != 0 && instr_count >= max_instrs)
+        limit_exceeded("Instruction");
+    if (max_ms != 0 && elapsed_ms() >= max_ms)
+        limit_exceeded("Time");
+    next_check = instr_count + WATCHDOG_INTERVAL;
+    if (max_instrs != 0 && next_check > max_instrs)
+        next_check = max_instrs;
+}
+
+// Called where a loop can close (backward branches, jumps and LOOP);
+// the limits are only checked every WATCHDOG_INTERVAL instructions
+static inline void watchdog_checkpoint()
+{
+    if (instr_count >= next_check)
+        watchdog_check();
+}
+
+// Transfer control to target, ending the current basic block
+static inline void jump_to(address_type target)
+{
+    instr_count += (PC - block_start) / BYTES_PER_WORD;
+    PC = block_start = target;
+}
+
+// Take a branch with the encoded offset o from the current PC
+static inline void branch(immediate_type o)
+{
+    int offset = machine_types_formOffset(o);
+    jump_to(PC + offset);
+    if (offset < 0)
+        watchdog_checkpoint();
+}
+
+// Return addr, after checking that the length bytes at addr are in memory
+static int memory_range(int addr, int length)
+{
+    if (addr < 0 || length < 0 || addr > MEMORY_SIZE_IN_BYTES - length)
+        program_error("Memory range of %d bytes at address %d is out of bounds",
+                      length, addr);
+    return addr;
+}
+
+// Return the index of the word at addr, after checking that the registers
+// that mask selects (bit i selects register first + i) exist, and that
+// the words they are loaded from or stored to are in memory
+static int multiple_range(int addr, reg_num_type first, immediate_type mask)
+{
+    if (mask != 0 && first + 31 - __builtin_clz(mask) >= NUM_REGISTERS)
+        program_error("Register mask 0x%x from register %u is out of range",
+                      mask, first);
+    memory_range(addr, BYTES_PER_WORD * __builtin_popcount(mask));
+    return addr / BYTES_PER_WORD;
+}
+
+// Read a line of at most length - 1 bytes from stdin into memory at addr,
+// followed by a null byte; return its length, or -1 at the end of input
+static int read_line(int addr, int length)
+{
+    char *buf = (char *)&memory.bytes[memory_range(addr, length)];
+    if (length == 0)
+        return -1;
+    if (length == 1)
+    {
+        // fgets reads nothing then, so look ahead for the end of input
+        int c = getchar();
+        if (c == EOF)
+            return -1;
+        ungetc(c, stdin);
+        buf[0] = '\0';
+    }
+    else if (fgets(buf, length, stdin) == NULL)
+        return -1;
+    memory_written(addr, length);
+    return strlen(buf);
+}
+
+// Return the null-terminated string at addr, after checking it is in memory
+static const char *memory_string(int addr)
+{
+    memory_range(addr, 0);
+    if (memchr(&memory.bytes[addr], '\0', MEMORY_SIZE_IN_BYTES - addr) == NULL)
+        program_error("String at address %d is not null-terminated", addr);
+    return (const char *)&memory.bytes[addr];
+}
+
+// Buffer the decimal (base 10) or hexadecimal (base 16) digits of value,
+// preceded by a '-' if is_signed and value is negative;
+// return the number of characters buffered
+static int print_number(word_type value, bool is_signed, unsigned int base)
+{
+    char buf[16];
+    char *p = buf + sizeof(buf);
+    unsigned int u = value;
+    if (is_signed && value < 0)
+        u = -(unsigned int)value;
+    do
+    {
+        *--p = "0123456789abcdef"[u % base];
+        u /= base;
+    } while (u != 0);
+    if (is_signed && value < 0)
+        *--p = '-';
+    int n = buf + sizeof(buf) - p;
+    console_write(p, n);
+    return n;
+}
+
+// Read a decimal integer, optionally signed and preceded by white space,
+// from stdin into $v0; $v1 is set to 0, or to -1 if there was no integer
+static void read_int()
+{
+    int c;
+    do
+    {
+        c = fgetc(stdin);
+    } while (isspace(c));
+    bool negative = (c == '-');
+    if (c == '-' || c == '+')
+        c = fgetc(stdin);
+    unsigned int value = 0;
+    bool digits = false;
+    while (isdigit(c))
+    {
+        value = value * 10 + (c - '0');
+        digits = true;
+        c = fgetc(stdin);
+    }
+    if (c != EOF)
+        ungetc(c, stdin);
+    GPR[2] = negative ? -value : value;
+    GPR[3] = digits ? 0 : -1;
+}
+
+// Put the low 32 bits of value in $v0 and the high 32 bits in $v1
+static void set_result64(unsigned long long value)
+{
+    GPR[2] = (word_type)(value & 0xFFFFFFFF);
+    GPR[3] = (word_type)(value >> 32);
+}
+
+// Return the host's monotonic clock in microseconds
+static unsigned long long clock_us()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Map at most length bytes of the host file with the given handle
+// into memory at addr, which must be aligned to a host page;
+// return the number of bytes mapped, or -1 on error
+static int map_file(int handle, int addr, int length)
+{
+    memory_range(addr, length);
+    int page = hostfile_page_size();
+    if (addr % page != 0)
+        return -1;
+    // Whole pages are replaced (memory is padded to whole pages)
+    memory_written(addr, (length + page - 1) / page * page);
+    return hostfile_map(handle, &memory.bytes[addr], length);
+}
+
+// Return the single precision float whose bits are in w
+static inline float word_to_float(word_type w)
+{
+    float f;
+    memcpy(&f, &w, sizeof(f));
+    return f;
+}
+
+// Return the word holding the bits of the single precision float f
+static inline word_type float_to_word(float f)
+{
+    word_type w;
+    memcpy(&w, &f, sizeof(w));
+    return w;
+}
+
+// Return f truncated to a word, saturating when it is out of range;
+// NaN converts to 0 (plain C conversion is undefined in these cases)
+static word_type float_to_int(float f)
+{
+    if (f != f)
+        return 0;
+    if (f >= 2147483648.0f)
+        return INT_MAX;
+    if (f < -2147483648.0f)
+        return INT_MIN;
+    return (word_type)f;
+}
+
 // Execute the syscall that corresponds to the given code
 void execute_syscall_instruction(unsigned int code)
 {
@@ -63,14 +431,77 @@ void execute_syscall_instruction(unsigned int code)
         exit(0);
         break;
     case print_str_sc:
-        printf("%s", &memory.bytes[GPR[4]]);
+        console_puts((const char *)&memory.bytes[GPR[4]]);
         break;
     case print_char_sc:
-        GPR[2] = fputc(GPR[4], stdout);
+        GPR[2] = console_putc(GPR[4]);
         break;
     case read_char_sc:
+        console_before_read();
         GPR[2] = fgetc(stdin);
         break;
+    case read_buf_sc:
+        console_before_read();
+        GPR[2] = fread(&memory.bytes[memory_range(GPR[4], GPR[5])], 1, GPR[5],
+                       stdin);
+        memory_written(GPR[4], GPR[2]);
+        break;
+    case write_buf_sc:
+        console_write((const char *)&memory.bytes[memory_range(GPR[4], GPR[5])],
+                      GPR[5]);
+        GPR[2] = GPR[5];
+        break;
+    case read_line_sc:
+        console_before_read();
+        GPR[2] = read_line(GPR[4], GPR[5]);
+        break;
+    case print_int_sc:
+        GPR[2] = print_number(GPR[4], true, 10);
+        break;
+    case print_hex_sc:
+        GPR[2] = print_number(GPR[4], false, 16);
+        break;
+    case read_int_sc:
+        console_before_read();
+        read_int();
+        break;
+    case instr_count_sc:
+        // Includes this instruction, as PC has already been incremented
+        set_result64(machine_instr_count());
+        break;
+    case clock_sc:
+        set_result64(clock_us());
+        break;
+    case memory_copy_sc:
+        // The ranges may overlap
+        memmove(&memory.bytes[memory_range(GPR[4], GPR[6])],
+                &memory.bytes[memory_range(GPR[5], GPR[6])], GPR[6]);
+        memory_written(GPR[4], GPR[6]);
+        GPR[2] = GPR[4];
+        break;
+    case memory_set_sc:
+        memset(&memory.bytes[memory_range(GPR[4], GPR[6])], GPR[5], GPR[6]);
+        memory_written(GPR[4], GPR[6]);
+        GPR[2] = GPR[4];
+        break;
+    case file_open_sc:
+        GPR[2] = hostfile_open(memory_string(GPR[4]), GPR[5]);
+        break;
+    case file_read_sc:
+        GPR[2] = hostfile_read(GPR[4], &memory.bytes[memory_range(GPR[5], GPR[6])],
+                               GPR[6]);
+        memory_written(GPR[5], GPR[6]);
+        break;
+    case file_write_sc:
+        GPR[2] = hostfile_write(GPR[4], &memory.bytes[memory_range(GPR[5], GPR[6])],
+                                GPR[6]);
+        break;
+    case file_close_sc:
+        GPR[2] = hostfile_close(GPR[4]);
+        break;
+    case file_map_sc:
+        GPR[2] = map_file(GPR[4], GPR[5], GPR[6]);
+        break;
     case start_tracing_sc:
         tracing_active = true;
         break;
@@ -78,9 +509,18 @@ void execute_syscall_instruction(unsigned int code)
         tracing_active = false;
         break;
     default:
-        bail_with_error("Unknown code (%d) in execute_syscall_instruction", code);
+    {
+        // Native system calls registered by plugins
+        srm_native_fn fn = plugin_syscall(code);
+        if (fn == NULL)
+            program_error("Unknown code (%d) in execute_syscall_instruction", code);
+        GPR[2] = fn(GPR[4], GPR[5], GPR[6], GPR[7], memory.bytes,
+                    MEMORY_SIZE_IN_BYTES);
+        // Plugins may write anywhere in memory
+        memory_written(0, MEMORY_SIZE_IN_BYTES);
         break;
     }
+    }
 }
 
 // Execute register/computational instruction (or syscall if func == SYSCALL_F)
@@ -104,7 +544,7 @@ void execute_reg_instruction(bin_instr_t bi)
         break;
     case DIV_F:
         if (GPR[bi.reg.rt] == 0)
-            bail_with_error("Divide by zero error");
+            program_error("Divide by zero error");
         LO = GPR[bi.reg.rs] / GPR[bi.reg.rt];
         HI = GPR[bi.reg.rs] % GPR[bi.reg.rt];
         break;
@@ -126,21 +566,141 @@ void execute_reg_instruction(bin_instr_t bi)
     case XOR_F:
         GPR[bi.reg.rd] = GPR[bi.reg.rs] ^ GPR[bi.reg.rt];
         break;
+    case SLT_F:
+        GPR[bi.reg.rd] = GPR[bi.reg.rs] < GPR[bi.reg.rt];
+        break;
+    case SLTU_F:
+        GPR[bi.reg.rd] = (unsigned int)GPR[bi.reg.rs] < (unsigned int)GPR[bi.reg.rt];
+        break;
+    case MOVZ_F:
+        // Conditional expressions, so the host can use conditional moves
+        GPR[bi.reg.rd] = (GPR[bi.reg.rt] == 0) ? GPR[bi.reg.rs] : GPR[bi.reg.rd];
+        break;
+    case MOVN_F:
+        GPR[bi.reg.rd] = (GPR[bi.reg.rt] != 0) ? GPR[bi.reg.rs] : GPR[bi.reg.rd];
+        break;
+    case LWX_F:
+        // Indexed loads and stores use the word or byte at rs + (scale * rt)
+        GPR[bi.reg.rd] = memory.words[(GPR[bi.reg.rs] +
+                                       BYTES_PER_WORD * GPR[bi.reg.rt]) /
+                                      BYTES_PER_WORD];
+        break;
+    case SWX_F:
+    {
+        int index = GPR[bi.reg.rs] + BYTES_PER_WORD * GPR[bi.reg.rt];
+        memory.words[index / BYTES_PER_WORD] = GPR[bi.reg.rd];
+        memory_written(index, BYTES_PER_WORD);
+        break;
+    }
+    case LBUX_F:
+        GPR[bi.reg.rd] = machine_types_zeroExt(memory.bytes[GPR[bi.reg.rs] +
+                                                            GPR[bi.reg.rt]]);
+        break;
+    case SBX_F:
+        memory.bytes[GPR[bi.reg.rs] + GPR[bi.reg.rt]] = GPR[bi.reg.rd];
+        memory_written(GPR[bi.reg.rs] + GPR[bi.reg.rt], 1);
+        break;
+    case PADDB_F:
+        GPR[bi.reg.rd] = simd_add(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_bytes);
+        break;
+    case PADDH_F:
+        GPR[bi.reg.rd] = simd_add(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_halfwords);
+        break;
+    case PSUBB_F:
+        GPR[bi.reg.rd] = simd_sub(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_bytes);
+        break;
+    case PSUBH_F:
+        GPR[bi.reg.rd] = simd_sub(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_halfwords);
+        break;
+    case PADDUSB_F:
+        GPR[bi.reg.rd] = simd_add_saturating(GPR[bi.reg.rs], GPR[bi.reg.rt],
+                                             simd_bytes);
+        break;
+    case PADDUSH_F:
+        GPR[bi.reg.rd] = simd_add_saturating(GPR[bi.reg.rs], GPR[bi.reg.rt],
+                                             simd_halfwords);
+        break;
+    case PCMPEQB_F:
+        GPR[bi.reg.rd] = simd_cmpeq(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_bytes);
+        break;
+    case PCMPEQH_F:
+        GPR[bi.reg.rd] = simd_cmpeq(GPR[bi.reg.rs], GPR[bi.reg.rt], simd_halfwords);
+        break;
+    case PSELB_F:
+        // rd holds the mask (as made by PCMPEQB) on entry
+        GPR[bi.reg.rd] = simd_select(GPR[bi.reg.rs], GPR[bi.reg.rt], GPR[bi.reg.rd]);
+        break;
+    case FADD_F:
+        GPR[bi.reg.rd] = float_to_word(word_to_float(GPR[bi.reg.rs]) +
+                                       word_to_float(GPR[bi.reg.rt]));
+        break;
+    case FSUB_F:
+        GPR[bi.reg.rd] = float_to_word(word_to_float(GPR[bi.reg.rs]) -
+                                       word_to_float(GPR[bi.reg.rt]));
+        break;
+    case FMUL_F:
+        GPR[bi.reg.rd] = float_to_word(word_to_float(GPR[bi.reg.rs]) *
+                                       word_to_float(GPR[bi.reg.rt]));
+        break;
+    case FDIV_F:
+        // IEEE semantics: dividing by zero gives an infinity or NaN
+        GPR[bi.reg.rd] = float_to_word(word_to_float(GPR[bi.reg.rs]) /
+                                       word_to_float(GPR[bi.reg.rt]));
+        break;
+    case FEQ_F:
+        // Comparisons are false when either operand is NaN
+        GPR[bi.reg.rd] = word_to_float(GPR[bi.reg.rs]) ==
+                         word_to_float(GPR[bi.reg.rt]);
+        break;
+    case FLT_F:
+        GPR[bi.reg.rd] = word_to_float(GPR[bi.reg.rs]) <
+                         word_to_float(GPR[bi.reg.rt]);
+        break;
+    case FLE_F:
+        GPR[bi.reg.rd] = word_to_float(GPR[bi.reg.rs]) <=
+                         word_to_float(GPR[bi.reg.rt]);
+        break;
+    case CVTSW_F:
+        GPR[bi.reg.rd] = float_to_word((float)GPR[bi.reg.rs]);
+        break;
+    case CVTWS_F:
+        GPR[bi.reg.rd] = float_to_int(word_to_float(GPR[bi.reg.rs]));
+        break;
     case SLL_F:
         GPR[bi.reg.rd] = GPR[bi.reg.rt] << bi.reg.shift;
         break;
     case SRL_F:
+        GPR[bi.reg.rd] = (unsigned int)GPR[bi.reg.rt] >> bi.reg.shift;
+        break;
+    case SRA_F:
         GPR[bi.reg.rd] = GPR[bi.reg.rt] >> bi.reg.shift;
         break;
+    case SLLV_F:
+        // As in MIPS, rt is shifted by the low 5 bits of rs
+        GPR[bi.reg.rd] = (unsigned int)GPR[bi.reg.rt] << (GPR[bi.reg.rs] & 0x1F);
+        break;
+    case SRLV_F:
+        GPR[bi.reg.rd] = (unsigned int)GPR[bi.reg.rt] >> (GPR[bi.reg.rs] & 0x1F);
+        break;
     case JR_F:
-        PC = GPR[bi.reg.rs];
+        jump_to(GPR[bi.reg.rs]);
+        watchdog_checkpoint();
+        break;
+    case JALR_F:
+    {
+        // Read the target first, in case rs and rd are the same register
+        address_type target = GPR[bi.reg.rs];
+        GPR[bi.reg.rd] = PC;
+        jump_to(target);
+        watchdog_checkpoint();
         break;
+    }
     case SYSCALL_F:
         execute_syscall_instruction(instruction_syscall_number(bi));
         break;
     default:
-        bail_with_error("Unknown function code (%d) in execute_reg_instruction",
-                        bi.reg.func);
+        program_error("Unknown function code (%d) in execute_reg_instruction",
+                      bi.reg.func);
         break;
     }
 }
@@ -166,29 +726,46 @@ void execute_immed_instruction(bin_instr_t bi)
     case XORI_O:
         GPR[bi.immed.rt] = GPR[bi.immed.rs] ^ machine_types_zeroExt(bi.immed.immed);
         break;
+    case LUI_O:
+        GPR[bi.immed.rt] = machine_types_zeroExt(bi.immed.immed) << 16;
+        break;
+    case SLTI_O:
+        GPR[bi.immed.rt] = GPR[bi.immed.rs] < machine_types_sgnExt(bi.immed.immed);
+        break;
+    case SLTIU_O:
+        // as in MIPS, the immediate is sign extended, then compared unsigned
+        GPR[bi.immed.rt] = (unsigned int)GPR[bi.immed.rs] <
+                           (unsigned int)machine_types_sgnExt(bi.immed.immed);
+        break;
     case BEQ_O:
         if (GPR[bi.immed.rs] == GPR[bi.immed.rt])
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
         break;
     case BGEZ_O:
         if (GPR[bi.immed.rs] >= 0)
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
         break;
     case BGTZ_O:
         if (GPR[bi.immed.rs] > 0)
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
         break;
     case BLEZ_O:
         if (GPR[bi.immed.rs] <= 0)
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
         break;
     case BLTZ_O:
         if (GPR[bi.immed.rs] < 0)
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
         break;
     case BNE_O:
         if (GPR[bi.immed.rs] != GPR[bi.immed.rt])
-            PC += machine_types_formOffset(bi.immed.immed);
+            branch(bi.immed.immed);
+        break;
+    case LOOP_O:
+        // closes a counted loop; a backward branch ends its basic block,
+        // so the watchdog checks once per iteration at most
+        if (--GPR[bi.immed.rs] != 0)
+            branch(bi.immed.immed);
         break;
     case LBU_O:
     {
@@ -206,24 +783,71 @@ void execute_immed_instruction(bin_instr_t bi)
     {
         int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
         memory.bytes[index] = GPR[bi.immed.rt];
+        memory_written(index, 1);
+        break;
+    }
+    case LB_O:
+    {
+        int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
+        GPR[bi.immed.rt] = (signed char)memory.bytes[index];
+        break;
+    }
+    case LH_O:
+    {
+        int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
+        GPR[bi.immed.rt] = (short)memory.halfwords[index / BYTES_PER_HALFWORD];
+        break;
+    }
+    case LHU_O:
+    {
+        int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
+        GPR[bi.immed.rt] = memory.halfwords[index / BYTES_PER_HALFWORD];
+        break;
+    }
+    case SH_O:
+    {
+        int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
+        memory.halfwords[index / BYTES_PER_HALFWORD] = GPR[bi.immed.rt];
+        memory_written(index, BYTES_PER_HALFWORD);
+        break;
+    }
+    case LWM_O:
+    {
+        // The selected registers are loaded from consecutive words
+        int index = multiple_range(GPR[bi.immed.rs], bi.immed.rt, bi.immed.immed);
+        for (unsigned int m = bi.immed.immed; m != 0; m &= m - 1)
+            GPR[bi.immed.rt + __builtin_ctz(m)] = memory.words[index++];
+        break;
+    }
+    case SWM_O:
+    {
+        // The selected registers are stored to consecutive words
+        int index = multiple_range(GPR[bi.immed.rs], bi.immed.rt, bi.immed.immed);
+        memory_written(index * BYTES_PER_WORD,
+                       BYTES_PER_WORD * __builtin_popcount(bi.immed.immed));
+        for (unsigned int m = bi.immed.immed; m != 0; m &= m - 1)
+            memory.words[index++] = GPR[bi.immed.rt + __builtin_ctz(m)];
         break;
     }
     case SW_O:
     {
         int index = GPR[bi.immed.rs] + machine_types_formOffset(bi.immed.immed);
         memory.words[index / BYTES_PER_WORD] = GPR[bi.immed.rt];
+        memory_written(index, BYTES_PER_WORD);
         break;
     }
     case JMP_O:
-        PC = machine_types_formAddress(PC, bi.jump.addr);
+        jump_to(machine_types_formAddress(PC, bi.jump.addr));
+        watchdog_checkpoint();
         break;
     case JAL_O:
         GPR[31] = PC;
-        PC = machine_types_formAddress(PC, bi.jump.addr);
+        jump_to(machine_types_formAddress(PC, bi.jump.addr));
+        watchdog_checkpoint();
         break;
     default:
-        bail_with_error("Unknown op code (%d) in execute_immed_instruction!",
-                        bi.immed.op);
+        program_error("Unknown op code (%d) in execute_immed_instruction!",
+                      bi.immed.op);
         break;
     }
 }
@@ -233,32 +857,47 @@ void execute_instruction(bin_instr_t IR)
     execute_immed_instruction(IR);
 }
 
+// Report that the invariant cond (its source text) does not hold and exit;
+// bail_with_error writes out the buffered output, including the trace, first
+static void invariant_failed(const char *cond)
+{
+    program_error("Invariant %s does not hold at PC %d", cond, PC);
+}
+
+// Check that the invariant cond holds
+#define invariant(cond) ((cond) ? (void)0 : invariant_failed(#cond))
+
 // Enforces required invariants
 void check_invariants()
 {
-    assert(PC % BYTES_PER_WORD == 0);
-    assert(GPR[GP] % BYTES_PER_WORD == 0);
-    assert(GPR[SP] % BYTES_PER_WORD == 0);
-    assert(GPR[FP] % BYTES_PER_WORD == 0);
-    assert(0 <= GPR[GP]);
-    assert(GPR[GP] < GPR[SP]);
-    assert(GPR[SP] <= GPR[FP]);
-    assert(GPR[FP] < MEMORY_SIZE_IN_BYTES);
-    assert(0 <= PC);
-    assert(PC < MEMORY_SIZE_IN_BYTES);
-    assert(GPR[0] == 0);
+    invariant(PC % BYTES_PER_WORD == 0);
+    invariant(GPR[GP] % BYTES_PER_WORD == 0);
+    invariant(GPR[SP] % BYTES_PER_WORD == 0);
+    invariant(GPR[FP] % BYTES_PER_WORD == 0);
+    invariant(0 <= GPR[GP]);
+    invariant(GPR[GP] < GPR[SP]);
+    invariant(GPR[SP] <= GPR[FP]);
+    invariant(GPR[FP] < MEMORY_SIZE_IN_BYTES);
+    invariant(0 <= PC);
+    invariant(PC < MEMORY_SIZE_IN_BYTES);
+    invariant(GPR[0] == 0);
 }
 
 // Executes loaded program and prints tracing ouput
 void machine_exec()
 {
     bin_instr_t IR;
+    block_start = PC;
+    clock_gettime(CLOCK_MONOTONIC, &exec_start);
+    if (max_instrs != 0 || max_ms != 0)
+        watchdog_check();
     while (true)
     {
         check_invariants();
         if (tracing_active)
         {
-            trace_state(GPR, memory, PC, HI, LO);
+            // Trace output shares the console's buffer, so it stays in order
+            trace_state(&view);
             trace_instr(PC, memory.instrs[PC / BYTES_PER_WORD]);
         }
         IR = memory.instrs[PC / BYTES_PER_WORD];
@@ -279,5 +918,7 @@ void machine_print_program()
         printf("%4d %s\n", instr_address,
                instruction_assembly_form(memory.instrs[text_start_index + i]));
     }
-    trace_data(GPR, memory);
+    trace_data(&view);
+    // The console is not flushed at exit when the program is not run
+    console_flush();
 }
\ No newline at end of file
@@ -1,26 +1,96 @@
 #ifndef _MACHINE_H
 #define _MACHINE_H
+#include "bof.h"
 #include "instruction.h"
 #include "machine_types.h"
 #include "regname.h"
 
 #define MEMORY_SIZE_IN_BYTES (65536 - BYTES_PER_WORD)
 #define MEMORY_SIZE_IN_WORDS (MEMORY_SIZE_IN_BYTES / BYTES_PER_WORD)
+#define BYTES_PER_HALFWORD 2
+#define MEMORY_SIZE_IN_HALFWORDS (MEMORY_SIZE_IN_BYTES / BYTES_PER_HALFWORD)
+
+// Memory is aligned and padded to whole host pages (of at most this size)
+// so that host files can be mapped into it
+#define MEMORY_PAGE_ALIGNMENT 65536
 
 // Memory union type
 typedef union
 {
     byte_type bytes[MEMORY_SIZE_IN_BYTES];
+    unsigned short halfwords[MEMORY_SIZE_IN_HALFWORDS];
     bin_instr_t instrs[MEMORY_SIZE_IN_WORDS];
     word_type words[MEMORY_SIZE_IN_WORDS];
+    byte_type pages[MEMORY_PAGE_ALIGNMENT];
 } mem_u;
 
+// Writes to memory are tracked in chunks of this many bytes
+#define MEMORY_CHUNK_SIZE 256
+#define MEMORY_CHUNKS \
+    ((MEMORY_SIZE_IN_BYTES + MEMORY_CHUNK_SIZE - 1) / MEMORY_CHUNK_SIZE)
+
+// Number of instructions between checks of the execution limits
+#define WATCHDOG_INTERVAL 65536
+
+// Exit code used when an execution limit is exceeded
+#define MACHINE_LIMIT_EXIT_CODE 124
+
 // Register type
 typedef int reg_type;
 
+// Loaded program: header and initial memory contents
+typedef struct
+{
+    BOFHeader header;
+    mem_u memory;
+} machine_image_t;
+
+// Read-only view of the running machine's registers and memory,
+// for tracing and other code that inspects the machine without copying it
+typedef struct
+{
+    const reg_type *GPR; // NUM_REGISTERS general purpose registers
+    const mem_u *memory;
+    const address_type *PC;
+    const reg_type *HI, *LO;
+    // Number of times memory was written; memory is unchanged while it is
+    const unsigned long *memory_writes;
+} machine_view_t;
+
 // Initialize machine state from binary object file
 extern void machine_init(const char *filename);
 
+// Load machine state from an open binary object file
+extern void machine_load(BOFFILE bof);
+
+// Save the loaded program (header and initial memory) into image
+extern void machine_save_image(machine_image_t *image);
+
+// Reset machine state to the start of the program saved in image
+extern void machine_restore_image(const machine_image_t *image);
+
+// Return a view of the machine's state, which follows it as it runs
+extern const machine_view_t *machine_view();
+
+// Return whether any of the length bytes at addr were written
+// since the machine view's memory_writes was equal to since
+extern bool machine_memory_written_since(int addr, int length,
+                                         unsigned long since);
+
+// Return the number of instructions executed so far
+extern unsigned long long machine_instr_count();
+
+// Load the plugin in the shared object at path, adding its system calls
+extern void machine_load_plugin(const char *path);
+
+// Allow the program to access host files below the directory dir
+extern void machine_set_sandbox(const char *dir);
+
+// Limit execution to max_instructions instructions and max_millis
+// milliseconds of wall clock time (0 means no limit)
+extern void machine_set_limits(unsigned long long max_instructions,
+                               unsigned long max_millis);
+
 // Executes loaded program and prints tracing ouput
 extern void machine_exec();
 
@@ -1,28 +1,116 @@
 #include <stdlib.h>
 #include <string.h>
+#include "console.h"
 #include "machine.h"
 #include "utilities.h"
 
+// Name of this program, for the usage message
+static const char *progname;
+
+// Print the usage message and exit
+static void usage()
+{
+    bail_with_error("Usage: %s [--max-instructions N] [--max-ms N]\n"
+                    "          [--flush exit|newline|size|read] [--flush-size N]\n"
+                    "          [--sandbox DIR] [--plugin LIB.so]... vm_testN.bof\n"
+                    "       %s -p vm_testN.bof",
+                    progname, progname);
+}
+
+// Return the value of the numeric option named opt, given as arg
+static unsigned long long option_value(const char *opt, const char *arg)
+{
+    char *end;
+    unsigned long long value = strtoull(arg, &end, 10);
+    if (*arg == '\0' || *end != '\0' || value == 0)
+        bail_with_error("Bad value for %s: %s", opt, arg);
+    return value;
+}
+
 int main(int argc, char **argv)
 {
-    if (argc == 2)
+    progname = argv[0];
+    argc--;
+    argv++;
+
+    bool print_program = false;
+    unsigned long long max_instructions = 0;
+    unsigned long max_millis = 0;
+    console_flush_policy policy = flush_before_read;
+    size_t flush_size = CONSOLE_DEFAULT_THRESHOLD;
+    const char *sandbox = NULL;
+    while (argc > 1 && argv[0][0] == '-')
     {
-        // Load and run program
-        machine_init(argv[1]);
-        machine_exec();
+        if (strcmp(argv[0], "-p") == 0)
+        {
+            // Ran with -p flag; print program
+            print_program = true;
+            argc--;
+            argv++;
+        }
+        else if (strcmp(argv[0], "--max-instructions") == 0 && argc > 2)
+        {
+            max_instructions = option_value(argv[0], argv[1]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (strcmp(argv[0], "--max-ms") == 0 && argc > 2)
+        {
+            max_millis = option_value(argv[0], argv[1]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (strcmp(argv[0], "--flush") == 0 && argc > 2)
+        {
+            policy = console_policy_named(argv[1]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (strcmp(argv[0], "--flush-size") == 0 && argc > 2)
+        {
+            flush_size = option_value(argv[0], argv[1]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (strcmp(argv[0], "--plugin") == 0 && argc > 2)
+        {
+            // Plugins are loaded before the program, in the order given
+            machine_load_plugin(argv[1]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (strcmp(argv[0], "--sandbox") == 0 && argc > 2)
+        {
+            sandbox = argv[1];
+            argc -= 2;
+            argv += 2;
+        }
+        else
+        {
+            usage();
+        }
     }
-    else if (argc == 3 && strcmp(argv[1], "-p") == 0)
+    if (argc != 1 ||
+        (print_program && (max_instructions || max_millis || sandbox)))
+    {
+        // Invalid arguments
+        usage();
+    }
+
+    machine_init(argv[0]);
+    if (print_program)
     {
-        // Ran with -p flag; print program
-        machine_init(argv[2]);
         machine_print_program();
     }
     else
     {
-        // Invalid arguments
-        bail_with_error("Usage: %s vm_testN.bof\n       %s -p vm_testN.bof\n",
-                        argv[0], argv[0]);
+        // Load and run program
+        console_init(policy, flush_size);
+        machine_set_limits(max_instructions, max_millis);
+        if (sandbox != NULL)
+            machine_set_sandbox(sandbox);
+        machine_exec();
     }
 
     return 0;
-}
\ No newline at end of file
+}
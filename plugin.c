@@ -0,0 +1,58 @@
+#define _POSIX_C_SOURCE 200809L
+#include <dlfcn.h>
+#include "plugin.h"
+#include "utilities.h"
+
+// Registered native system calls, indexed by code less PLUGIN_FIRST_SYSCALL
+static srm_native_fn syscalls[PLUGIN_MAX_SYSCALLS];
+
+// Name of the plugin being loaded, for error messages
+static const char *loading;
+
+// Register fn (with the given name) as the system call with the given code
+static void plugin_register(unsigned int code, const char *name,
+                            srm_native_fn fn)
+{
+    if (code < PLUGIN_FIRST_SYSCALL ||
+        code >= PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS)
+        bail_with_error("Plugin %s: code %u of %s is not in [%d, %d)",
+                        loading, code, name, PLUGIN_FIRST_SYSCALL,
+                        PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS);
+    if (syscalls[code - PLUGIN_FIRST_SYSCALL] != NULL)
+        bail_with_error("Plugin %s: code %u of %s is already registered",
+                        loading, code, name);
+    syscalls[code - PLUGIN_FIRST_SYSCALL] = fn;
+}
+
+// Load the plugin in the shared object at path and register its system calls
+// Exit the program with an error if this fails
+void plugin_load(const char *path)
+{
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL)
+        bail_with_error("Cannot load plugin %s: %s", path, dlerror());
+
+    // Converting through a union avoids ISO C's object/function pointer rule
+    union
+    {
+        void *sym;
+        srm_plugin_init_fn init;
+    } u;
+    u.sym = dlsym(handle, PLUGIN_INIT_NAME);
+    if (u.sym == NULL)
+        bail_with_error("Plugin %s does not define %s", path, PLUGIN_INIT_NAME);
+
+    loading = path;
+    u.init(plugin_register);
+    loading = NULL;
+}
+
+// Return the native function for the system call code,
+// or NULL if no plugin registered it
+srm_native_fn plugin_syscall(unsigned int code)
+{
+    if (code < PLUGIN_FIRST_SYSCALL ||
+        code >= PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS)
+        return NULL;
+    return syscalls[code - PLUGIN_FIRST_SYSCALL];
+}
@@ -0,0 +1,42 @@
+#ifndef _PLUGIN_H
+#define _PLUGIN_H
+#include <stddef.h>
+#include "instruction.h"
+
+// Native extension system calls, loaded from shared objects.
+//
+// A plugin is a shared object that defines
+//     void srm_plugin_init(srm_register_fn register_syscall);
+// which calls register_syscall once for each native function it provides.
+// Native functions are called with the SRM's $a0-$a3 as arguments
+// and the SRM memory (of memory_size bytes); their result goes in $v0.
+// SRM programs call them with SYSCALL code.
+
+// Plugin system call codes are in the range
+// [PLUGIN_FIRST_SYSCALL, PLUGIN_FIRST_SYSCALL + PLUGIN_MAX_SYSCALLS)
+// (see instruction.h)
+
+// Name of the function each plugin defines
+#define PLUGIN_INIT_NAME "srm_plugin_init"
+
+// A native system call
+typedef int (*srm_native_fn)(int a0, int a1, int a2, int a3,
+                             unsigned char *memory, size_t memory_size);
+
+// Function given to a plugin to register fn (with the given name)
+// as the system call with the given code
+typedef void (*srm_register_fn)(unsigned int code, const char *name,
+                                 srm_native_fn fn);
+
+// Type of a plugin's srm_plugin_init function
+typedef void (*srm_plugin_init_fn)(srm_register_fn register_syscall);
+
+// Load the plugin in the shared object at path and register its system calls
+// Exit the program with an error if this fails
+extern void plugin_load(const char *path);
+
+// Return the native function for the system call code,
+// or NULL if no plugin registered it
+extern srm_native_fn plugin_syscall(unsigned int code);
+
+#endif
@@ -0,0 +1,59 @@
+#include "simd.h"
+
+// Return a word with the high bit of each lane set
+static inline unsigned int high_bits(simd_lanes lanes)
+{
+    return lanes == simd_bytes ? 0x80808080 : 0x80008000;
+}
+
+// Return the word with all ones in the lanes whose high bit is set in h,
+// which has no other bits set
+static inline unsigned int widen_high_bits(unsigned int h, simd_lanes lanes)
+{
+    return (h >> (lanes - 1)) * ((1u << lanes) - 1);
+}
+
+// Return the lane by lane sum of a and b, wrapping around
+unsigned int simd_add(unsigned int a, unsigned int b, simd_lanes lanes)
+{
+    // Add the low bits, so no carry crosses into the next lane,
+    // then put back the high bits of each lane
+    unsigned int h = high_bits(lanes);
+    return ((a & ~h) + (b & ~h)) ^ ((a ^ b) & h);
+}
+
+// Return the lane by lane difference a - b, wrapping around
+unsigned int simd_sub(unsigned int a, unsigned int b, simd_lanes lanes)
+{
+    // Setting the high bits of a keeps borrows within each lane
+    unsigned int h = high_bits(lanes);
+    return ((a | h) - (b & ~h)) ^ ((a ^ ~b) & h);
+}
+
+// Return the lane by lane sum of a and b as unsigned numbers,
+// saturating at the largest value of a lane
+unsigned int simd_add_saturating(unsigned int a, unsigned int b,
+                                 simd_lanes lanes)
+{
+    unsigned int sum = simd_add(a, b, lanes);
+    // The lanes that carried out of their high bit overflowed
+    unsigned int carries = ((a & b) | ((a | b) & ~sum)) & high_bits(lanes);
+    return sum | widen_high_bits(carries, lanes);
+}
+
+// Return a word whose lanes are all ones where the lanes of a and b
+// are equal, and all zeros where they differ
+unsigned int simd_cmpeq(unsigned int a, unsigned int b, simd_lanes lanes)
+{
+    unsigned int h = high_bits(lanes);
+    unsigned int diff = a ^ b;
+    // The high bit of each lane of nonzero is set if that lane of diff is
+    unsigned int nonzero = (((diff & ~h) + ~h) | diff) & h;
+    return widen_high_bits(nonzero ^ h, lanes);
+}
+
+// Return the bits of a where mask has ones and the bits of b elsewhere
+unsigned int simd_select(unsigned int a, unsigned int b, unsigned int mask)
+{
+    return (a & mask) | (b & ~mask);
+}
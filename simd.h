@@ -0,0 +1,34 @@
+#ifndef _SIMD_H
+#define _SIMD_H
+
+// Packed operations on words holding 4 byte (8-bit) or 2 halfword
+// (16-bit) lanes, done on all the lanes at once within the word (SWAR)
+
+// Width of the lanes, in bits
+typedef enum
+{
+    simd_bytes = 8,
+    simd_halfwords = 16
+} simd_lanes;
+
+// Return the lane by lane sum of a and b, wrapping around
+extern unsigned int simd_add(unsigned int a, unsigned int b, simd_lanes lanes);
+
+// Return the lane by lane difference a - b, wrapping around
+extern unsigned int simd_sub(unsigned int a, unsigned int b, simd_lanes lanes);
+
+// Return the lane by lane sum of a and b as unsigned numbers,
+// saturating at the largest value of a lane
+extern unsigned int simd_add_saturating(unsigned int a, unsigned int b,
+                                        simd_lanes lanes);
+
+// Return a word whose lanes are all ones where the lanes of a and b
+// are equal, and all zeros where they differ
+extern unsigned int simd_cmpeq(unsigned int a, unsigned int b,
+                               simd_lanes lanes);
+
+// Return the bits of a where mask has ones and the bits of b elsewhere
+extern unsigned int simd_select(unsigned int a, unsigned int b,
+                                unsigned int mask);
+
+#endif
@@ -1,28 +1,194 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "console.h"
 #include "trace.h"
+#include "utilities.h"
+
+// Trace output is formatted by hand into growable text buffers, since the
+// trace is too large to format with printf; the parts of the machine state
+// that did not change since the last trace are copied from a cache instead
+
+// Most bytes added to a text by one call of text_int
+#define TRACE_FIELD_MAX 32
+
+// Number of registers shown on each row of the trace
+#define GPR_PER_ROW 6
+#define GPR_ROWS ((NUM_REGISTERS + GPR_PER_ROW - 1) / GPR_PER_ROW)
+
+// Formatted text and the number of bytes in it
+typedef struct
+{
+    char *buf;
+    size_t len;
+    size_t size;
+} trace_text;
+
+// Cached text of a row of registers, and the values it shows
+typedef struct
+{
+    bool valid;
+    reg_type values[GPR_PER_ROW];
+    trace_text text;
+} gpr_row_cache;
+
+// Cached text of a range of memory, and the state it was made from
+// (the words it shows end before scanned_end)
+typedef struct
+{
+    bool valid;
+    int start, end, scanned_end;
+    unsigned long memory_writes;
+    trace_text text;
+} range_cache;
+
+// Whether each chunk of memory holds only zeros, as of when memory_writes
+// was equal to zero_chunk_writes (if zero_chunk_known)
+static bool zero_chunk[MEMORY_CHUNKS];
+static bool zero_chunk_known[MEMORY_CHUNKS];
+static unsigned long zero_chunk_writes[MEMORY_CHUNKS];
+
+// Output of the current trace call, added to the console's buffer at its end
+static trace_text out;
+
+// "GPR[name]: " for each register, with the name padded to 3 columns
+static char gpr_labels[NUM_REGISTERS][sizeof("GPR[$ra]: ")];
+static bool gpr_labels_made = false;
+
+// Text last made for each row of registers and for the data and stack
+static gpr_row_cache gpr_rows[GPR_ROWS];
+static range_cache data_cache, stack_cache;
+
+// Make room in t for n more bytes
+static inline void text_reserve(trace_text *t, size_t n)
+{
+    if (t->len + n <= t->size)
+        return;
+    size_t size = t->size < 256 ? 256 : t->size;
+    while (size < t->len + n)
+        size *= 2;
+    t->buf = realloc(t->buf, size);
+    if (t->buf == NULL)
+        bail_with_error("Cannot allocate %zu bytes for the trace", size);
+    t->size = size;
+}
+
+// Add the n bytes in s to t
+static inline void text_str(trace_text *t, const char *s, size_t n)
+{
+    text_reserve(t, n);
+    memcpy(t->buf + t->len, s, n);
+    t->len += n;
+}
+
+// Add the string literal s to t
+#define text_lit(t, s) text_str(t, s, sizeof(s) - 1)
+
+// Add the character c to t
+static inline void text_char(trace_text *t, char c)
+{
+    text_reserve(t, 1);
+    t->buf[t->len++] = c;
+}
+
+// Add value in decimal to t, padded with spaces to width columns,
+// on the left if width > 0 (as by %8d) or on the right if width < 0 (%-4d)
+static void text_int(trace_text *t, int value, int width)
+{
+    char digits[12];
+    char *p = digits + sizeof(digits);
+    unsigned int u = value < 0 ? -(unsigned int)value : (unsigned int)value;
+    do
+    {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u != 0);
+    if (value < 0)
+        *--p = '-';
+    int len = digits + sizeof(digits) - p;
+    int pad = (width < 0 ? -width : width) - len;
+
+    text_reserve(t, TRACE_FIELD_MAX);
+    char *q = t->buf + t->len;
+    for (; width > 0 && pad > 0; pad--)
+        *q++ = ' ';
+    memcpy(q, p, len);
+    q += len;
+    for (; pad > 0; pad--)
+        *q++ = ' ';
+    t->len = q - t->buf;
+}
+
+// Add the output of this trace call to the console's buffer,
+// writing it out at once if standard output is a terminal
+static void out_flush()
+{
+    console_write_raw(out.buf, out.len);
+    out.len = 0;
+    if (console_on_terminal())
+        console_flush();
+}
+
+// Return whether chunk c of memory holds only zeros,
+// scanning it only if it was written since it was last scanned
+static bool chunk_is_zero(const machine_view_t *m, int c)
+{
+    int addr = c * MEMORY_CHUNK_SIZE;
+    if (!zero_chunk_known[c] ||
+        machine_memory_written_since(addr, MEMORY_CHUNK_SIZE,
+                                     zero_chunk_writes[c]))
+    {
+        const word_type *w = &m->memory->words[addr / BYTES_PER_WORD];
+        int n = MEMORY_CHUNK_SIZE / BYTES_PER_WORD;
+        if (addr + MEMORY_CHUNK_SIZE > MEMORY_SIZE_IN_BYTES)
+            n = (MEMORY_SIZE_IN_BYTES - addr) / BYTES_PER_WORD;
+        int i = 0;
+        while (i < n && w[i] == 0)
+            i++;
+        zero_chunk[c] = i == n;
+        zero_chunk_known[c] = true;
+        zero_chunk_writes[c] = *m->memory_writes;
+    }
+    return zero_chunk[c];
+}
 
 // Prints word values in memory over given range, omitting repeated zero values
 // If end is -1, stops at the first zero value
-void print_address_range(word_type words[], int start, int end)
+// Return the address just after the last word looked at
+static int print_address_range(trace_text *t, const machine_view_t *m,
+                               int start, int end)
 {
+    const word_type *words = m->memory->words;
     bool last_value_zero = false;
     int num_values_printed = 0;
     word_type value;
-    for (int i = start; end == -1 || i < end; i += BYTES_PER_WORD)
+    int i;
+    for (i = start; end == -1 || i < end; i += BYTES_PER_WORD)
     {
+        // Skip whole chunks of zeros after a zero, which were printed as "..."
+        while (last_value_zero && i % MEMORY_CHUNK_SIZE == 0 &&
+               i + MEMORY_CHUNK_SIZE <= end &&
+               chunk_is_zero(m, i / MEMORY_CHUNK_SIZE))
+            i += MEMORY_CHUNK_SIZE;
+        if (end != -1 && i >= end)
+            break;
+
         value = words[i / BYTES_PER_WORD];
         // Repeated value of zero, so skip
         if (value == 0 && last_value_zero)
             continue;
 
         // Print address and value
-        printf("%8d: %d\t", i, value);
+        text_int(t, i, 8);
+        text_lit(t, ": ");
+        text_int(t, value, 0);
+        text_char(t, '\t');
 
         // Record whether this value was zero and print ellipses if necessary
         if (value == 0)
         {
             last_value_zero = true;
-            printf("...");
+            text_lit(t, "...");
         }
         else
         {
@@ -30,61 +196,122 @@ void print_address_range(word_type words[], int start, int end)
         }
 
         if (num_values_printed % 5 == 4)
-            printf("\n");
+            text_char(t, '\n');
         num_values_printed++;
 
         if (value == 0 && end == -1)
+        {
+            i += BYTES_PER_WORD;
             break;
+        }
     }
     if (num_values_printed % 5 != 0)
-        printf("\n");
+        text_char(t, '\n');
+    return i;
+}
+
+// Prints the given range of memory, reusing the text in c if the range
+// did not move and none of the words it was made from were written since
+static void print_cached_range(range_cache *c, const machine_view_t *m,
+                               int start, int end)
+{
+    if (!c->valid || c->start != start || c->end != end ||
+        machine_memory_written_since(start, c->scanned_end - start,
+                                     c->memory_writes))
+    {
+        c->text.len = 0;
+        c->scanned_end = print_address_range(&c->text, m, start, end);
+        c->start = start;
+        c->end = end;
+        c->memory_writes = *m->memory_writes;
+        c->valid = true;
+    }
+    text_str(&out, c->text.buf, c->text.len);
 }
 
 // Prints values of special purpose registers
-void trace_special(address_type PC, reg_type HI, reg_type LO)
+static void trace_special(address_type PC, reg_type HI, reg_type LO)
 {
     // Value of PC
-    printf("%8s: %d", "PC", PC);
+    text_lit(&out, "      PC: ");
+    text_int(&out, PC, 0);
     // Values of HI and LO if they're non-zero
     if (HI != 0 || LO != 0)
-        printf("\t%8s: %d\t%8s: %d\n", "HI", HI, "LO", LO);
-    else
-        printf("\n");
+    {
+        text_lit(&out, "\t      HI: ");
+        text_int(&out, HI, 0);
+        text_lit(&out, "\t      LO: ");
+        text_int(&out, LO, 0);
+    }
+    text_char(&out, '\n');
 }
 
-// Prints values of GPR
-void trace_gpr(reg_type GPR[])
+// Prints values of GPR, reformatting only the rows whose values changed
+static void trace_gpr(const reg_type GPR[])
 {
-    for (int i = 0; i < NUM_REGISTERS; i++)
+    if (!gpr_labels_made)
+    {
+        for (int i = 0; i < NUM_REGISTERS; i++)
+            snprintf(gpr_labels[i], sizeof(gpr_labels[i]), "GPR[%-3s]: ",
+                     regname_get(i));
+        gpr_labels_made = true;
+    }
+    for (int row = 0; row < GPR_ROWS; row++)
     {
-        printf("GPR[%-3s]: %-4d", regname_get(i), GPR[i]);
-        printf(i % 6 == 5 || i == NUM_REGISTERS - 1 ? "\n" : "\t");
+        gpr_row_cache *c = &gpr_rows[row];
+        int first = row * GPR_PER_ROW;
+        int count = NUM_REGISTERS - first < GPR_PER_ROW ? NUM_REGISTERS - first
+                                                        : GPR_PER_ROW;
+        if (!c->valid || memcmp(c->values, &GPR[first],
+                                count * sizeof(reg_type)) != 0)
+        {
+            c->text.len = 0;
+            for (int i = first; i < first + count; i++)
+            {
+                text_str(&c->text, gpr_labels[i], strlen(gpr_labels[i]));
+                text_int(&c->text, GPR[i], -4);
+                bool row_end = i % GPR_PER_ROW == GPR_PER_ROW - 1 ||
+                               i == NUM_REGISTERS - 1;
+                text_char(&c->text, row_end ? '\n' : '\t');
+            }
+            memcpy(c->values, &GPR[first], count * sizeof(reg_type));
+            c->valid = true;
+        }
+        text_str(&out, c->text.buf, c->text.len);
     }
 }
 
 // Prints values between $gp and $sp (data section)
-void trace_data(reg_type GPR[], mem_u memory)
+void trace_data(const machine_view_t *m)
 {
-    print_address_range(memory.words, GPR[GP], -1);
+    print_cached_range(&data_cache, m, m->GPR[GP], -1);
+    out_flush();
 }
 
 // Prints values between $sp and $fp (runtime stack)
-void trace_stack(reg_type GPR[], mem_u memory)
+static void trace_stack(const machine_view_t *m)
 {
-    print_address_range(memory.words, GPR[SP], GPR[FP] + BYTES_PER_WORD);
+    print_cached_range(&stack_cache, m, m->GPR[SP], m->GPR[FP] + BYTES_PER_WORD);
 }
 
 // Prints state of registers and memory
-void trace_state(reg_type GPR[], mem_u memory, address_type PC, reg_type HI, reg_type LO)
+void trace_state(const machine_view_t *m)
 {
-    trace_special(PC, HI, LO);
-    trace_gpr(GPR);
-    trace_data(GPR, memory);
-    trace_stack(GPR, memory);
+    trace_special(*m->PC, *m->HI, *m->LO);
+    trace_gpr(m->GPR);
+    trace_data(m);
+    trace_stack(m);
+    out_flush();
 }
 
 // Prints address and assembly form of instruction
 void trace_instr(address_type PC, bin_instr_t bi)
 {
-    printf("==> addr: %4d %s\n", PC, instruction_assembly_form(bi));
-}
\ No newline at end of file
+    const char *form = instruction_assembly_form(bi);
+    text_lit(&out, "==> addr: ");
+    text_int(&out, PC, 4);
+    text_char(&out, ' ');
+    text_str(&out, form, strlen(form));
+    text_char(&out, '\n');
+    out_flush();
+}
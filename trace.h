@@ -3,12 +3,12 @@
 #include "machine.h"
 
 // Prints state of registers and memory
-extern void trace_state(reg_type GPR[], mem_u memory, address_type PC, reg_type HI, reg_type LO);
+extern void trace_state(const machine_view_t *m);
 
 // Prints address and assembly form of instruction
 extern void trace_instr(address_type PC, bin_instr_t bi);
 
 // Prints values between $gp and $sp (data section)
-extern void trace_data(reg_type GPR[], mem_u memory);
+extern void trace_data(const machine_view_t *m);
 
 #endif
@@ -42,12 +42,27 @@ static void vdebug_print(const char *fmt, va_list args)
 
 static void vbail_with_error(const char* fmt, va_list args);
 
+// function to flush other buffered output before an error message, if any
+static void (*bail_flush)(void) = NULL;
+
+// Register flush to be called before bail_with_error prints its message,
+// so that output buffered elsewhere than stdout comes out first.
+void on_bail(void (*flush)(void))
+{
+    bail_flush = flush;
+}
+
 // Format a string error message and print it followed by a newline on stderr
 // using perror (for an OS error, if the errno is not 0)
 // then exit with a failure code, so a call to this does not return.
 void bail_with_error(const char *fmt, ...)
 {
     fflush(stdout); // flush so output comes after what has happened already
+    if (bail_flush != NULL) {
+	int saved_errno = errno;
+	bail_flush();
+	errno = saved_errno;
+    }
     va_list(args);
     va_start(args, fmt);
     vbail_with_error(fmt, args);
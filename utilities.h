@@ -15,6 +15,10 @@ void debug_print(const char *fmt, ...);
 // then exit with a failure code, so a call to this does not return.
 extern void bail_with_error(const char *fmt, ...);
 
+// Register flush to be called before bail_with_error prints its message,
+// so that output buffered elsewhere than stdout comes out first.
+extern void on_bail(void (*flush)(void));
+
 // print a newline on out and flush out
 extern void newline(FILE *out);
 
@@ -0,0 +1,10 @@
+	# an endless loop, for checking the VM's execution limits
+	.text start
+start:	NOTR			# no tracing, so the loop runs quickly
+	ADDI $0, $t0, 0
+again:	ADDI $t0, $t0, 1
+	BEQ $0, $0, -2		# loop forever
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
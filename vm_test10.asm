@@ -0,0 +1,31 @@
+	# reading and printing numbers (the input is in vm_test10.in)
+	.text start
+start:	RINT			# $v0 is 42, $v1 is 0
+	ADD $0, $v0, $t0
+	RINT			# $v0 is -17
+	ADD $0, $v0, $t1
+	RINT			# $v0 is 8 (after its '+')
+	ADD $0, $v0, $t2
+	RINT			# $v1 is -1, as "x" has no digits
+	ADD $0, $v1, $t3
+	ADD $t0, $t1, $a0
+	ADD $a0, $t2, $a0
+	PINT			# prints 33
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $t1, $a0
+	PINT			# prints -17
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $t1, $a0
+	PHEX			# prints ffffffef
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $t3, $a0
+	PINT			# prints -1
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
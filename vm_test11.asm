@@ -0,0 +1,20 @@
+	# counting executed instructions
+	.text start
+start:	ICNT			# $v0 is 1, as the count includes ICNT itself
+	ADD $0, $v0, $t0
+	ADDI $0, $t1, 5		# $t1 counts 5 iterations
+again:	ADDI $t1, $t1, -1
+	BNE $t1, $0, -2		# 2 instructions per iteration
+	ICNT			# $v0 is 14 (1 + 2 + 5 * 2 + 1)
+	SUB $v0, $t0, $a0	# $a0 is 13, the instructions since the first ICNT
+	PINT			# prints 13
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $v1, $a0
+	PINT			# prints 0, the high word of the count
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
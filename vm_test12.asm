@@ -0,0 +1,26 @@
+	# copying and setting blocks of memory
+	.text start
+start:	ADD $0, $gp, $a0
+	ADDI $0, $a1, 0x41
+	ADDI $0, $a2, 6
+	MSET			# the 6 bytes at $gp are all 'A'
+	ADDI $gp, $a0, 2
+	ADDI $0, $a1, 0x42
+	ADDI $0, $a2, 2
+	MSET			# "AABBAA"
+	ADDI $gp, $a0, 8
+	ADD $0, $gp, $a1
+	ADDI $0, $a2, 6
+	MCPY			# "AABBAA" at $gp+8 too
+	ADDI $gp, $a0, 9
+	ADDI $gp, $a1, 8
+	ADDI $0, $a2, 5
+	MCPY			# an overlapping copy: "AAABBA" at $gp+8
+	ADDI $gp, $a0, 8
+	PSTR			# prints AAABBA (the byte after it is 0)
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
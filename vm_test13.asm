@@ -0,0 +1,29 @@
+	# LI at the boundaries of each of its expansions, and LUI
+	.text start
+start:	LI $t0, 0		# $t0 is 0 (ADDI)
+	LI $t1, -32768		# $t1 is -32768 (ADDI)
+	LI $t2, 32767		# $t2 is 32767 (ADDI)
+	LI $t3, 32768		# $t3 is 32768 (BORI)
+	LI $t4, 65535		# $t4 is 65535 (BORI)
+	LI $t5, 65536		# $t5 is 65536 (LUI)
+	LI $t6, 2147483647	# $t6 is 0x7fffffff (LUI and BORI)
+	LI $t7, -2147483648	# $t7 is 0x80000000 (LUI)
+	LI $s0, -1		# $s0 is -1 (ADDI)
+	LI $s1, -32769		# $s1 is 0xffff7fff (LUI and BORI)
+	LUI $s2, 0x1234		# $s2 is 0x12340000
+	ADD $0, $t6, $a0
+	PINT			# prints 2147483647
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $s1, $a0
+	PINT			# prints -32769
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $s2, $a0
+	PHEX			# prints 12340000
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,29 @@
+	# Shifts: SRL is logical, SRA is arithmetic, and SLLV and SRLV
+	# shift by the low 5 bits of a register
+	.text start
+start:	LI $t0, -256		# $t0 is 0xffffff00
+	SRL $t0, $t1, 4		# $t1 is 0x0ffffff0
+	SRA $t0, $t2, 4		# $t2 is 0xfffffff0
+	ADDI $0, $t3, 36	# $t3 is 36, so shifts by 4
+	SLLV $t3, $t0, $t4	# $t4 is 0xfffff000
+	SRLV $t3, $t0, $t5	# $t5 is 0x0ffffff0
+	ADD $0, $t1, $a0
+	PHEX			# prints ffffff0
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $t2, $a0
+	PHEX			# prints fffffff0
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $t4, $a0
+	PHEX			# prints fffff000
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $t5, $a0
+	PHEX			# prints ffffff0
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,33 @@
+	# JALR through a table of text label addresses, and a data label
+	# address used as a pointer
+	.text start
+start:	ADDI $0, $a0, 21
+	LW $gp, $t0, 0		# $t0 is the address of double
+	JALR $t0, $ra		# calls double, so $a0 is 42
+	PINT			# prints 42
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADDI $0, $a0, 5
+	LW $gp, $ra, 1		# $ra is the address of square
+	JALR $ra, $ra		# reads the target before writing $ra
+	PINT			# prints 25
+	ADDI $0, $a0, 32
+	PCH
+	LW $gp, $t1, 2		# $t1 is the address of seven
+	LW $t1, $a0, 0		# so $a0 is 7
+	PINT			# prints 7
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+double:	ADD $a0, $a0, $a0
+	JR $ra
+square:	MUL $a0, $a0
+	MFLO $a0
+	JR $ra
+	.data 1024
+	WORD doubleAddr = double
+	WORD squareAddr = square
+	WORD sevenAddr = seven
+	WORD seven = 7
+	.stack 4096
+	.end
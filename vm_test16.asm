@@ -0,0 +1,29 @@
+	# saving and restoring registers with SWM and LWM
+	.text start
+start:	ADDI $0, $s0, 1
+	ADDI $0, $s1, 2
+	ADDI $0, $s2, 3
+	ADDI $sp, $sp, -12
+	SWM $sp, $s0, 7		# stores $s0, $s1 and $s2 at $sp
+	ADDI $0, $s0, 0
+	ADDI $0, $s1, 0
+	ADDI $0, $s2, 0
+	LWM $sp, $s0, 7		# $s0, $s1 and $s2 are 1, 2 and 3 again
+	ADDI $0, $t0, 10
+	ADDI $0, $t1, 20
+	ADDI $0, $t2, 30
+	SWM $gp, $t0, 5		# stores only $t0 and $t2, at $gp and $gp+4
+	LWM $gp, $t4, 3		# $t4 is 10 and $t5 is 30
+	ADD $s0, $s1, $a0
+	ADD $a0, $s2, $a0
+	PINT			# prints 6
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $t5, $a0
+	PINT			# prints 30
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
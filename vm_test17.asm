@@ -0,0 +1,26 @@
+	# a text section assembled in compressed form (asm -c), mixing
+	# instructions that have 16-bit forms with ones that do not
+	.text start
+start:	ADDI $sp, $sp, -8	# allocate 2 words (16-bit)
+	ADDI $0, $t0, 4		# $t0 counts 4 iterations
+	ADDI $0, $t1, 0
+again:	ADDI $t1, $t1, 3	# $t1 grows by 3 (16-bit)
+	ADDI $t0, $t0, -1	# (16-bit)
+	BNE $t0, $0, -3		# loop until $t0 is 0
+	SW $sp, $t1, 0		# save $t1 (16-bit)
+	SW $sp, $t0, 1		# save $t0 in the next word (16-bit)
+	ADD $0, $t1, $s0	# $s0 is 12 (16-bit)
+	JAL triple
+	LW $sp, $s1, 0		# $s1 is 12 (16-bit)
+	ADDI $sp, $sp, 8	# deallocate the 2 words (16-bit)
+	ADD $s0, $s1, $a0	# $a0 is 48
+	PINT			# prints 48 (16-bit)
+	ADDI $0, $a0, 10
+	PCH			# prints a newline (16-bit)
+	EXIT			# (16-bit)
+triple:	ADD $s0, $s0, $t2
+	ADD $t2, $s0, $s0	# $s0 is 36
+	JR $ra			# (16-bit)
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,43 @@
+	# packed byte and halfword (SIMD) instructions; carries and
+	# borrows must not cross from one lane into the next
+	.text start
+start:	LI $t0, 0x01ff7f80
+	LI $t1, 0x01018001
+	PADDB $t0, $t1, $t2	# $t2 is 0x0200ff81
+	PADDH $t0, $t1, $t3	# $t3 is 0x0300ff81
+	PSUBB $t1, $t0, $t4	# $t4 is 0x00020181
+	PSUBH $t1, $t0, $t5	# $t5 is 0xff020081
+	PADDUSB $t0, $t1, $t6	# $t6 is 0x02ffff81
+	PADDUSH $t1, $t1, $t7	# $t7 is 0x0202ffff
+	PCMPEQB $t0, $t1, $s0	# $s0 is 0xff000000
+	PCMPEQH $t2, $t3, $s1	# $s1 is 0x0000ffff
+	ADD $0, $s1, $s2
+	PSELB $t0, $t1, $s2	# $s2 is 0x01017f80
+	ADD $0, $t2, $a0
+	JAL show
+	ADD $0, $t3, $a0
+	JAL show
+	ADD $0, $t4, $a0
+	JAL show
+	ADD $0, $t5, $a0
+	JAL show
+	ADD $0, $t6, $a0
+	JAL show
+	ADD $0, $t7, $a0
+	JAL show
+	ADD $0, $s0, $a0
+	JAL show
+	ADD $0, $s1, $a0
+	JAL show
+	ADD $0, $s2, $a0
+	JAL show
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+show:	PHEX			# prints $a0 in hex, then a space
+	ADDI $0, $a0, 32
+	PCH
+	JR $ra
+	.data 1024
+	.stack 4096
+	.end
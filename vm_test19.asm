@@ -0,0 +1,35 @@
+	# byte and halfword loads and stores; LB and LH sign-extend,
+	# LBU and LHU zero-extend, and SH writes only 2 bytes
+	.text start
+start:	LI $t0, 0xffff80f7
+	SH $gp, $t0, 0		# the halfword at $gp is 0x80f7
+	LH $gp, $t1, 0		# $t1 is -32521
+	LHU $gp, $t2, 0		# $t2 is 33015
+	LB $gp, $t3, 0		# $t3 is -9 (the low byte, 0xf7)
+	ADDI $gp, $t4, 1
+	LB $t4, $t5, 0		# $t5 is -128 (the high byte, 0x80)
+	LBU $t4, $t6, 0		# $t6 is 128
+	SH $gp, $t0, 1		# the next word's low halfword is 0x80f7
+	LW $gp, $t7, 1		# $t7 is 0x80f7, the high halfword is still 0
+	ADD $0, $t1, $a0
+	JAL show
+	ADD $0, $t2, $a0
+	JAL show
+	ADD $0, $t3, $a0
+	JAL show
+	ADD $0, $t5, $a0
+	JAL show
+	ADD $0, $t6, $a0
+	JAL show
+	ADD $0, $t7, $a0
+	PHEX			# prints 80f7
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+show:	PINT			# prints $a0, then a space
+	ADDI $0, $a0, 32
+	PCH
+	JR $ra
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,30 @@
+	# conditional moves; when the condition fails rd is unchanged
+	.text start
+start:	ADDI $0, $t0, 5		# the value to move
+	ADDI $0, $t1, 3		# a non-zero condition
+	ADDI $0, $s0, 1
+	ADDI $0, $s1, 2
+	ADDI $0, $s2, 3
+	ADDI $0, $s3, 4
+	MOVZ $t0, $0, $s0	# $s0 is 5
+	MOVZ $t0, $t1, $s1	# $s1 is still 2
+	MOVN $t0, $t1, $s2	# $s2 is 5
+	MOVN $t0, $0, $s3	# $s3 is still 4
+	ADD $0, $s0, $a0
+	JAL show
+	ADD $0, $s1, $a0
+	JAL show
+	ADD $0, $s2, $a0
+	JAL show
+	ADD $0, $s3, $a0
+	PINT			# prints 5 2 5 4 in all
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+show:	PINT			# prints $a0, then a space
+	ADDI $0, $a0, 32
+	PCH
+	JR $ra
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,37 @@
+	# indexed loads and stores; LWX and SWX scale the index by 4,
+	# LBUX and SBX by 1
+	.text start
+start:	ADDI $0, $t0, 0		# $t0 is the index i
+	ADDI $0, $t1, 4		# fill 4 words
+fill:	MUL $t0, $t0
+	MFLO $t2
+	SWX $gp, $t0, $t2	# word i at $gp is i*i
+	ADDI $t0, $t0, 1
+	BNE $t0, $t1, -5	# loop back to fill
+	ADDI $0, $t3, 3
+	LWX $gp, $t3, $t4	# $t4 is 9
+	ADD $0, $t4, $a0
+	PINT			# prints 9
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADDI $gp, $s1, 16	# a string after the 4 words
+	ADDI $0, $t5, 0x6f
+	SBX $s1, $0, $t5	# byte 0 is 'o'
+	ADDI $0, $t5, 0x68
+	ADDI $0, $t6, 1
+	SBX $s1, $t6, $t5	# byte 1 is 'h'
+	ADDI $0, $t5, 0x69
+	ADDI $0, $t6, 2
+	SBX $s1, $t6, $t5	# byte 2 is 'i'
+	LBUX $s1, $t6, $a0	# $a0 is 105, the code of 'i'
+	PINT			# prints 105
+	ADDI $0, $a0, 32
+	PCH
+	ADD $0, $s1, $a0
+	PSTR			# prints ohi
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,27 @@
+	# counted loops with LOOP, which decrements its register and
+	# branches while the result is not zero
+	.text start
+start:	ADDI $0, $t0, 5		# $t0 counts 5 iterations
+	ADDI $0, $s0, 0
+sum:	ADD $s0, $t0, $s0	# $s0 grows by 5, 4, 3, 2 and 1
+	LOOP $t0, -2		# loop back to sum
+	ADDI $0, $t1, 1		# a count of 1 runs the body once
+	ADDI $0, $s1, 0
+once:	ADDI $s1, $s1, 7	# $s1 is 7
+	LOOP $t1, -2		# falls through, as $t1 becomes 0
+	ADD $0, $s0, $a0
+	PINT			# prints 15
+	ADDI $0, $a0, 32
+	PCH			# prints a space
+	ADD $0, $s1, $a0
+	PINT			# prints 7
+	ADDI $0, $a0, 32
+	PCH
+	ADD $t0, $t1, $a0
+	PINT			# prints 0, as both counters end at 0
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
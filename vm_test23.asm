@@ -0,0 +1,30 @@
+	# single precision arithmetic, comparisons and conversions
+	.text start
+start:	ADDI $0, $t0, 7
+	CVTSW $t0, $t0		# $t0 is 7.0
+	ADDI $0, $t1, 2
+	CVTSW $t1, $t1		# $t1 is 2.0
+	FDIV $t0, $t1, $t2	# $t2 is 3.5
+	FMUL $t2, $t1, $t3	# $t3 is 7.0
+	FADD $t2, $t1, $t4	# $t4 is 5.5
+	FSUB $t1, $t2, $t5	# $t5 is -1.5
+	CVTWS $t4, $s0		# $s0 is 5 (truncated)
+	CVTWS $t5, $s1		# $s1 is -1 (truncated toward zero)
+	FEQ $t0, $t3, $s2	# $s2 is 1
+	FLT $t0, $t3, $s3	# $s3 is 0
+	FLE $t0, $t3, $s4	# $s4 is 1
+	FLT $t5, $t1, $s5	# $s5 is 1
+	FDIV $t0, $0, $t6	# $t6 is +inf (0x7f800000)
+	CVTWS $t6, $s6		# $s6 saturates to 0x7fffffff
+	LI $t7, 0x7fc00000	# $t7 is a quiet NaN
+	FEQ $t7, $t7, $s7	# $s7 is 0, NaN is not equal to itself
+	ADDI $0, $t8, 1
+	CVTWS $t7, $t8		# $t8 is 0, as NaN converts to 0
+	ADD $0, $t2, $a0
+	PHEX			# prints 40600000
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,25 @@
+	# set on less than, signed and unsigned
+	.text start
+start:	ADDI $0, $t0, -5	# $t0 is -5
+	ADDI $0, $t1, 3		# $t1 is 3
+	SLT $t0, $t1, $t2	# $t2 is 1 (-5 < 3)
+	SLT $t1, $t0, $t3	# $t3 is 0
+	SLT $t1, $t1, $t4	# $t4 is 0 (3 < 3 is false)
+	SLTU $t0, $t1, $t5	# $t5 is 0 (0xfffffffb > 3 unsigned)
+	SLTU $t1, $t0, $t6	# $t6 is 1
+	SLTI $t1, $t7, 4	# $t7 is 1 (3 < 4)
+	SLTI $t0, $s0, -5	# $s0 is 0 (-5 < -5 is false)
+	SLTI $t0, $s1, -4	# $s1 is 1 (-5 < -4)
+	SLTIU $t1, $s2, -1	# $s2 is 1 (3 < 0xffffffff unsigned)
+	SLTIU $t0, $s3, 3	# $s3 is 0 (0xfffffffb > 3 unsigned)
+	ADD $t2, $t6, $a0
+	ADD $a0, $t7, $a0
+	ADD $a0, $s1, $a0
+	ADD $a0, $s2, $a0
+	PINT			# prints 5
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
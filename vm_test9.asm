@@ -0,0 +1,30 @@
+	# reading lines and blocks of input (from vm_test9.in)
+	# and writing them back out
+	.text start
+start:	ADD $0, $gp, $a0	# the buffer is at $gp
+	ADDI $0, $a1, 64
+	RLN			# $v0 is 13, for "hello, world\n"
+	ADD $0, $v0, $a1
+	WBUF			# writes the line
+	ADDI $0, $a1, 4
+	RLN			# $v0 is 3, for "sec" (the rest is still unread)
+	ADD $0, $v0, $a1
+	WBUF			# writes "sec"
+	ADDI $0, $a1, 1
+	RLN			# $v0 is 0, as only the null byte fits
+	ADDI $0, $a1, 64
+	RBUF			# $v0 is 14, for "ond line\nlast\n"
+	ADD $0, $v0, $a1
+	WBUF			# writes the rest of the input
+	ADDI $0, $a1, 64
+	RLN			# $v0 is -1 at the end of input
+	ADDI $0, $a1, 1
+	RLN			# $v0 is still -1
+	ADD $0, $v0, $a0
+	PINT			# prints -1
+	ADDI $0, $a0, 10
+	PCH			# prints a newline
+	EXIT
+	.data 1024
+	.stack 4096
+	.end
@@ -0,0 +1,101 @@
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "utilities.h"
+#include "vmd.h"
+
+// Read all of the file f into a newly allocated buffer
+// and set *length to the number of bytes read
+static char *read_file(FILE *f, size_t *length)
+{
+    size_t size = BUFSIZ, used = 0, rd;
+    char *buf = malloc(size);
+    while (buf != NULL && (rd = fread(buf + used, 1, size - used, f)) > 0)
+    {
+        used += rd;
+        if (used == size)
+        {
+            size *= 2;
+            buf = realloc(buf, size);
+        }
+    }
+    if (buf == NULL)
+        bail_with_error("Cannot allocate input buffer");
+    *length = used;
+    return buf;
+}
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+    if (argc == 4 && strcmp(argv[1], "-v") == 0)
+    {
+        // Ran with -v flag; print counters on stderr
+        verbose = true;
+        argc--;
+        argv++;
+    }
+    if (argc != 3)
+    {
+        // Invalid arguments
+        bail_with_error("Usage: %s socket vm_testN.bof\n       %s -v socket vm_testN.bof",
+                        argv[0], argv[0]);
+    }
+
+    // Read the job's image and standard input
+    FILE *bof = fopen(argv[2], "rb");
+    if (bof == NULL)
+        bail_with_error("Error opening file for reading: %s", argv[2]);
+    size_t image_length, input_length;
+    char *image = read_file(bof, &image_length);
+    fclose(bof);
+    char *input = read_file(stdin, &input_length);
+
+    // Send the job; the daemon may reject the image before the input is
+    // sent, so a failure to send is reported only if no response follows
+    int sock = vmd_connect(argv[1]);
+    signal(SIGPIPE, SIG_IGN);
+    vmd_request_t req;
+    req.magic = VMD_MAGIC;
+    req.image_length = image_length;
+    req.input_length = input_length;
+    bool sent = vmd_write_all(sock, &req, sizeof(req)) == 0 &&
+                vmd_write_all(sock, image, image_length) == 0 &&
+                vmd_write_all(sock, input, input_length) == 0;
+
+    // Copy the job's output to stdout
+    vmd_response_t resp;
+    if (vmd_read_all(sock, &resp, sizeof(resp)) != 0 || resp.magic != VMD_MAGIC)
+    {
+        if (!sent)
+            bail_with_error("Cannot send job to %s", argv[1]);
+        bail_with_error("Bad response from %s", argv[1]);
+    }
+    char buf[BUFSIZ];
+    uint32_t remaining = resp.output_length;
+    while (remaining > 0)
+    {
+        size_t n = remaining < sizeof(buf) ? remaining : sizeof(buf);
+        if (vmd_read_all(sock, buf, n) != 0)
+            bail_with_error("Truncated output from %s", argv[1]);
+        fwrite(buf, 1, n, stdout);
+        remaining -= n;
+    }
+    fflush(stdout);
+    close(sock);
+
+    if (resp.status == VMD_STATUS_BAD_IMAGE)
+    {
+        errno = 0; // not an OS error, though sending the input may have failed
+        bail_with_error("Invalid BOF file: %s", argv[2]);
+    }
+    if (verbose)
+        fprintf(stderr, "status: %d\tinstructions: %llu\ttime: %llu us%s\n",
+                resp.status, (unsigned long long)resp.instr_count,
+                (unsigned long long)resp.elapsed_us,
+                resp.cached ? "\t(cached)" : "");
+    return resp.status;
+}
@@ -0,0 +1,355 @@
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "console.h"
+#include "machine.h"
+#include "utilities.h"
+#include "vmd.h"
+
+// Cached image of a loaded BOF file
+typedef struct
+{
+    uint64_t hash;
+    uint32_t length;
+    unsigned char *bytes;
+    machine_image_t *image;
+} vmd_cache_entry_t;
+
+// Loaded images, replaced round robin
+static vmd_cache_entry_t cache[VMD_CACHE_SIZE];
+static int cache_next = 0;
+
+// Counters shared between a job's handler and the process running the VM
+typedef struct
+{
+    uint64_t instr_count;
+} vmd_counters_t;
+
+// Counters of the job run by this process, if it is a job's handler
+static vmd_counters_t *counters = NULL;
+
+// Return the 64-bit FNV-1a hash of the n bytes in buf
+static uint64_t vmd_hash(const unsigned char *buf, size_t n)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < n; i++)
+    {
+        h ^= buf[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Return the current monotonic time in microseconds
+static uint64_t vmd_now_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Return the time by which a request started now must have been read
+static uint64_t vmd_read_deadline()
+{
+    return vmd_now_us() + (uint64_t)VMD_READ_TIMEOUT_SECONDS * 1000000;
+}
+
+// Read exactly n bytes from fd into buf before the monotonic time deadline
+// (in microseconds, see vmd_now_us)
+// Return 0 on success and -1 on error, early end of file or a missed deadline
+static int vmd_read_by(int fd, void *buf, size_t n, uint64_t deadline)
+{
+    char *p = buf;
+    while (n > 0)
+    {
+        uint64_t now = vmd_now_us();
+        if (now >= deadline)
+            return -1;
+        struct pollfd pfd = {fd, POLLIN, 0};
+        int ready = poll(&pfd, 1, (deadline - now + 999) / 1000);
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready <= 0)
+            return -1;
+        ssize_t rd = read(fd, p, n);
+        if (rd < 0 && errno == EINTR)
+            continue;
+        if (rd <= 0)
+            return -1;
+        p += rd;
+        n -= rd;
+    }
+    return 0;
+}
+
+// Return whether the n bytes in buf hold a BOF file that can be loaded
+// without running off the end of the file or of memory
+static bool vmd_image_valid(const unsigned char *buf, size_t n)
+{
+    BOFHeader h;
+    if (n < sizeof(h))
+        return false;
+    memcpy(&h, buf, sizeof(h));
+    if (h.text_start_address < 0 || h.text_length < 0 ||
+        h.data_start_address < 0 || h.data_length < 0 ||
+        h.stack_bottom_addr < 0)
+        return false;
+    bool compressed = bof_is_compressed(h);
+    int text_unit = compressed ? BYTES_PER_WORD / 2 : BYTES_PER_WORD;
+    if (h.text_start_address % BYTES_PER_WORD != 0 ||
+        h.text_length % text_unit != 0 ||
+        h.data_start_address % BYTES_PER_WORD != 0 ||
+        h.data_length % BYTES_PER_WORD != 0 ||
+        h.stack_bottom_addr % BYTES_PER_WORD != 0)
+        return false;
+    if (h.text_length > MEMORY_SIZE_IN_BYTES - h.text_start_address ||
+        h.data_length > MEMORY_SIZE_IN_BYTES - h.data_start_address ||
+        h.stack_bottom_addr >= MEMORY_SIZE_IN_BYTES ||
+        (size_t)h.text_length + h.data_length > n - sizeof(h))
+        return false;
+    // Expanding compressed text must not fail (which would exit the daemon)
+    // or run off the end of memory
+    return !compressed ||
+           instruction_expand_text(buf + sizeof(h), h.text_length, NULL,
+                                   (MEMORY_SIZE_IN_BYTES - h.text_start_address) /
+                                       BYTES_PER_WORD) >= 0;
+}
+
+// Return the loaded image for the n bytes in buf,
+// loading it and adding it to the cache if it is not already there
+// Sets *cached to whether it was found in the cache
+static machine_image_t *vmd_cache_lookup(unsigned char *buf, uint32_t n,
+                                         bool *cached)
+{
+    uint64_t hash = vmd_hash(buf, n);
+    for (int i = 0; i < VMD_CACHE_SIZE; i++)
+    {
+        if (cache[i].image != NULL && cache[i].hash == hash &&
+            cache[i].length == n && memcmp(cache[i].bytes, buf, n) == 0)
+        {
+            *cached = true;
+            return cache[i].image;
+        }
+    }
+    *cached = false;
+
+    // Load the image and save the resulting machine state
+    vmd_cache_entry_t *e = &cache[cache_next];
+    cache_next = (cache_next + 1) % VMD_CACHE_SIZE;
+    if (e->image == NULL)
+        e->image = malloc(sizeof(machine_image_t));
+    if (e->image == NULL)
+        bail_with_error("vmd: cannot allocate image");
+    free(e->bytes);
+    e->bytes = buf;
+    e->hash = hash;
+    e->length = n;
+
+    BOFFILE bof;
+    bof.filename = "<job>";
+    bof.fileptr = fmemopen(buf, n, "rb");
+    if (bof.fileptr == NULL)
+        bail_with_error("vmd: cannot open image");
+    machine_load(bof);
+    fclose(bof.fileptr);
+    machine_save_image(e->image);
+    return e->image;
+}
+
+// Record the VM's counters for the handler when it exits
+static void vmd_record_counters()
+{
+    counters->instr_count = machine_instr_count();
+}
+
+// Send a response with the given status and output to client
+static void vmd_respond(int client, int status, uint64_t instr_count,
+                        uint64_t elapsed_us, bool cached, FILE *output)
+{
+    vmd_response_t resp;
+    memset(&resp, 0, sizeof(resp));
+    resp.magic = VMD_MAGIC;
+    resp.status = status;
+    resp.instr_count = instr_count;
+    resp.elapsed_us = elapsed_us;
+    resp.cached = cached;
+
+    long length = 0;
+    if (output != NULL)
+    {
+        fflush(output);
+        length = ftell(output);
+        rewind(output);
+    }
+    resp.output_length = length;
+    if (vmd_write_all(client, &resp, sizeof(resp)) != 0)
+        return;
+
+    char buf[BUFSIZ];
+    while (length > 0)
+    {
+        size_t rd = fread(buf, 1, sizeof(buf), output);
+        if (rd == 0 || vmd_write_all(client, buf, rd) != 0)
+            return;
+        length -= rd;
+    }
+}
+
+// Read the job's input (the rest of the request) from client, run the
+// program in image with it and send the results to client; runs in its
+// own process, so neither the client nor the VM can disturb the daemon
+static void vmd_handle_job(int client, const machine_image_t *image,
+                           bool cached, size_t input_length)
+{
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    char *input = malloc(input_length + 1);
+    if (in == NULL || out == NULL || input == NULL ||
+        vmd_read_by(client, input, input_length, vmd_read_deadline()) != 0)
+        _exit(EXIT_FAILURE);
+
+    // Counters are written by the VM's process and read here
+    counters = mmap(NULL, sizeof(vmd_counters_t), PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (counters == MAP_FAILED)
+        _exit(EXIT_FAILURE);
+    counters->instr_count = 0;
+    if (input_length > 0 && fwrite(input, input_length, 1, in) != 1)
+        _exit(EXIT_FAILURE);
+    free(input);
+    fflush(in);
+    rewind(in);
+
+    uint64_t start = vmd_now_us();
+    pid_t pid = fork();
+    if (pid < 0)
+        _exit(EXIT_FAILURE);
+    if (pid == 0)
+    {
+        // Run the VM with the job's input and output as its standard files
+        dup2(fileno(in), STDIN_FILENO);
+        dup2(fileno(out), STDOUT_FILENO);
+        dup2(fileno(out), STDERR_FILENO);
+        signal(SIGPIPE, SIG_DFL);
+        console_init(flush_on_exit, 0);
+        machine_restore_image(image);
+        atexit(vmd_record_counters);
+        machine_exec();
+        exit(EXIT_SUCCESS);
+    }
+
+    int wstatus;
+    while (waitpid(pid, &wstatus, 0) < 0 && errno == EINTR)
+        ;
+    uint64_t elapsed = vmd_now_us() - start;
+    int status = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus)
+                                    : 128 + WTERMSIG(wstatus);
+    vmd_respond(client, status, counters->instr_count, elapsed, cached, out);
+    _exit(EXIT_SUCCESS);
+}
+
+// Read one request's header and image from client and start running it
+// Return whether a job process was started
+static bool vmd_accept_job(int client)
+{
+    uint64_t deadline = vmd_read_deadline();
+    vmd_request_t req;
+    if (vmd_read_by(client, &req, sizeof(req), deadline) != 0 ||
+        req.magic != VMD_MAGIC ||
+        req.image_length > VMD_MAX_IMAGE_LENGTH ||
+        req.input_length > VMD_MAX_INPUT_LENGTH)
+        return false;
+
+    unsigned char *image_bytes = malloc(req.image_length + 1);
+    if (image_bytes == NULL ||
+        vmd_read_by(client, image_bytes, req.image_length, deadline) != 0)
+    {
+        free(image_bytes);
+        return false;
+    }
+
+    if (!vmd_image_valid(image_bytes, req.image_length))
+    {
+        vmd_respond(client, VMD_STATUS_BAD_IMAGE, 0, 0, false, NULL);
+        free(image_bytes);
+        return false;
+    }
+
+    bool cached;
+    machine_image_t *image = vmd_cache_lookup(image_bytes, req.image_length,
+                                              &cached);
+    if (cached)
+        free(image_bytes);
+
+    fflush(NULL);
+    pid_t pid = fork();
+    if (pid == 0)
+        vmd_handle_job(client, image, cached, req.input_length);
+    return pid > 0;
+}
+
+// Listen on the Unix domain socket at socket_path and run jobs,
+// at most pool_size of them at a time; does not return
+void vmd_serve(const char *socket_path, int pool_size)
+{
+    struct sockaddr_un addr;
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+        bail_with_error("vmd: socket path too long: %s", socket_path);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0)
+        bail_with_error("vmd: cannot create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+    // Remove a socket left by an earlier daemon, but nothing else
+    struct stat st;
+    if (lstat(socket_path, &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode))
+            bail_with_error("vmd: %s exists and is not a socket", socket_path);
+        unlink(socket_path);
+    }
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+        bail_with_error("vmd: cannot bind %s", socket_path);
+    if (listen(sock, SOMAXCONN) != 0)
+        bail_with_error("vmd: cannot listen on %s", socket_path);
+    signal(SIGPIPE, SIG_IGN);
+
+    int running = 0;
+    while (true)
+    {
+        // Reap finished jobs, waiting for one if the pool is full
+        while (running > 0 && waitpid(-1, NULL, WNOHANG) > 0)
+            running--;
+        while (running > 0 && running >= pool_size)
+        {
+            if (waitpid(-1, NULL, 0) > 0)
+                running--;
+            else if (errno != EINTR)
+                running = 0;
+        }
+
+        int client = accept(sock, NULL, NULL);
+        if (client < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            bail_with_error("vmd: accept failed");
+        }
+        if (vmd_accept_job(client))
+            running++;
+        close(client);
+    }
+}
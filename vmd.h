@@ -0,0 +1,67 @@
+#ifndef _VMD_H
+#define _VMD_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Magic numbers at the start of requests and responses ("VMD1")
+#define VMD_MAGIC 0x31444d56
+
+// Default and largest number of jobs that may run at the same time
+#define VMD_DEFAULT_POOL_SIZE 4
+#define VMD_MAX_POOL_SIZE 256
+
+// Number of loaded BOF images kept in the daemon's cache
+#define VMD_CACHE_SIZE 32
+
+// Largest BOF image and standard input accepted in a job
+#define VMD_MAX_IMAGE_LENGTH (1 << 20)
+#define VMD_MAX_INPUT_LENGTH (16 << 20)
+
+// Seconds a client has to send the whole of a request before it is dropped;
+// the daemon reads the header and image itself, so a client that stalls
+// cannot hold up the others for longer, and the job's process reads the input
+#define VMD_READ_TIMEOUT_SECONDS 5
+
+// Exit status reported when the job's BOF image is rejected
+#define VMD_STATUS_BAD_IMAGE -1
+
+// Job request, followed by image_length bytes of BOF image
+// and then input_length bytes of standard input
+typedef struct
+{
+    uint32_t magic;
+    uint32_t image_length;
+    uint32_t input_length;
+} vmd_request_t;
+
+// Job response, followed by output_length bytes of output
+// (standard output and standard error of the VM, interleaved)
+typedef struct
+{
+    uint32_t magic;
+    int32_t status;       // exit code, or 128 + signal number if killed
+    uint64_t instr_count; // number of instructions executed
+    uint64_t elapsed_us;  // wall clock time of the run in microseconds
+    uint32_t output_length;
+    uint32_t cached;      // non-zero if the image was already loaded
+} vmd_response_t;
+
+// Listen on the Unix domain socket at socket_path and run jobs,
+// at most pool_size of them at a time; does not return
+extern void vmd_serve(const char *socket_path, int pool_size);
+
+// The following are shared by the daemon and its client (in vmd_io.c)
+
+// Read exactly n bytes from fd into buf
+// Return 0 on success and -1 on error or early end of file
+extern int vmd_read_all(int fd, void *buf, size_t n);
+
+// Write exactly n bytes from buf to fd
+// Return 0 on success and -1 on error
+extern int vmd_write_all(int fd, const void *buf, size_t n);
+
+// Connect to the daemon at socket_path and return the connected socket
+// Exit the program with an error if this fails
+extern int vmd_connect(const char *socket_path);
+
+#endif
@@ -0,0 +1,62 @@
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "utilities.h"
+#include "vmd.h"
+
+// Read exactly n bytes from fd into buf
+// Return 0 on success and -1 on error or early end of file
+int vmd_read_all(int fd, void *buf, size_t n)
+{
+    char *p = buf;
+    while (n > 0)
+    {
+        ssize_t rd = read(fd, p, n);
+        if (rd < 0 && errno == EINTR)
+            continue;
+        if (rd <= 0)
+            return -1;
+        p += rd;
+        n -= rd;
+    }
+    return 0;
+}
+
+// Write exactly n bytes from buf to fd
+// Return 0 on success and -1 on error
+int vmd_write_all(int fd, const void *buf, size_t n)
+{
+    const char *p = buf;
+    while (n > 0)
+    {
+        ssize_t wr = write(fd, p, n);
+        if (wr < 0 && errno == EINTR)
+            continue;
+        if (wr <= 0)
+            return -1;
+        p += wr;
+        n -= wr;
+    }
+    return 0;
+}
+
+// Connect to the daemon at socket_path and return the connected socket
+// Exit the program with an error if this fails
+int vmd_connect(const char *socket_path)
+{
+    struct sockaddr_un addr;
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+        bail_with_error("Socket path too long: %s", socket_path);
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0)
+        bail_with_error("Cannot create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+        bail_with_error("Cannot connect to %s", socket_path);
+    return sock;
+}
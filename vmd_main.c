@@ -0,0 +1,77 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "machine.h"
+#include "utilities.h"
+#include "vmd.h"
+
+// Name of this program, for the usage message
+static const char *progname;
+
+// Print the usage message and exit
+static void usage()
+{
+    bail_with_error("Usage: %s [-j N] [--max-instructions N] [--max-ms N] socket",
+                    progname);
+}
+
+// Return the value of the numeric option named opt, given as arg,
+// which must be between 1 and max
+static unsigned long long option_value(const char *opt, const char *arg,
+                                       unsigned long long max)
+{
+    char *end;
+    errno = 0;
+    unsigned long long value = strtoull(arg, &end, 10);
+    if (*arg == '\0' || *end != '\0' || value == 0 || value > max ||
+        errno != 0)
+    {
+        errno = 0;
+        bail_with_error("Bad value for %s: %s (use 1 to %llu)", opt, arg, max);
+    }
+    return value;
+}
+
+int main(int argc, char **argv)
+{
+    progname = argv[0];
+    argc--;
+    argv++;
+
+    int pool_size = VMD_DEFAULT_POOL_SIZE;
+    unsigned long long max_instructions = 0;
+    unsigned long max_millis = 0;
+    while (argc > 2 && argv[0][0] == '-')
+    {
+        if (strcmp(argv[0], "-j") == 0)
+        {
+            // Number of jobs run at once
+            pool_size = option_value(argv[0], argv[1], VMD_MAX_POOL_SIZE);
+        }
+        else if (strcmp(argv[0], "--max-instructions") == 0)
+        {
+            max_instructions = option_value(argv[0], argv[1], ULLONG_MAX);
+        }
+        else if (strcmp(argv[0], "--max-ms") == 0)
+        {
+            max_millis = option_value(argv[0], argv[1], ULONG_MAX);
+        }
+        else
+        {
+            usage();
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc != 1)
+    {
+        // Invalid arguments
+        usage();
+    }
+
+    // Jobs inherit the limits, as they run in processes forked from here
+    machine_set_limits(max_instructions, max_millis);
+    vmd_serve(argv[0], pool_size);
+    return 0;
+}